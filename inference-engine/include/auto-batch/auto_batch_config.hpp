@@ -0,0 +1,75 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for Auto-Batching plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods
+ *
+ * @file auto_batch_config.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Auto-Batching plugin configuration
+ */
+namespace AutoBatchConfigParams {
+
+/**
+ * @def AUTO_BATCH_CONFIG_KEY(name)
+ * @brief A macro which provides an AUTO_BATCH-mangled name for configuration key with name `name`
+ */
+#define AUTO_BATCH_CONFIG_KEY(name) InferenceEngine::AutoBatchConfigParams::_CONFIG_KEY(AUTO_BATCH_##name)
+
+#define DECLARE_AUTO_BATCH_CONFIG_KEY(name) DECLARE_CONFIG_KEY(AUTO_BATCH_##name)
+
+/**
+ * @brief The device which executes batched requests, with an optional batch size in brackets, e.g. "CPU(16)".
+ * Set automatically for the "BATCH:CPU(16)" device name
+ */
+DECLARE_AUTO_BATCH_CONFIG_KEY(DEVICE);
+
+/**
+ * @brief The maximal number of requests collected into one batch, 8 by default.
+ * The batch size in brackets of the AUTO_BATCH_DEVICE value takes precedence
+ */
+DECLARE_AUTO_BATCH_CONFIG_KEY(SIZE);
+
+/**
+ * @brief Latency budget in milliseconds: a batch is started when it is full or when its first request
+ * has waited for this time, 1 by default
+ */
+DECLARE_AUTO_BATCH_CONFIG_KEY(TIMEOUT);
+
+}  // namespace AutoBatchConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric to get a float with the average number of requests in executed batches,
+ * String value is "AUTO_BATCH_AVERAGE_BATCH_SIZE"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(AUTO_BATCH_AVERAGE_BATCH_SIZE, float);
+
+/**
+ * @brief Metric to get a float with the average time in milliseconds requests waited for their batch to start,
+ * String value is "AUTO_BATCH_AVERAGE_QUEUEING_DELAY"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(AUTO_BATCH_AVERAGE_QUEUEING_DELAY, float);
+
+/**
+ * @brief Metric to get a uint64_t with the number of executed batches,
+ * String value is "AUTO_BATCH_COMPLETED_BATCHES"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(AUTO_BATCH_COMPLETED_BATCHES, uint64_t);
+
+}  // namespace Metrics
+}  // namespace InferenceEngine
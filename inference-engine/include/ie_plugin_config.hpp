@@ -10,6 +10,8 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -153,11 +155,33 @@ DECLARE_EXEC_NETWORK_METRIC_KEY(NETWORK_NAME, std::string);
  */
 DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
 
+/**
+ * @brief Metric which defines support of import/export functionality by plugin
+ *
+ * Core uses the metric to decide whether compiled networks can be stored in the cache
+ * directory set via CONFIG_KEY(CACHE_DIR). String value is "IMPORT_EXPORT_SUPPORT"
+ */
+DECLARE_METRIC_KEY(IMPORT_EXPORT_SUPPORT, bool);
+
 /**
  * @brief Metric to get an unsigned integer value of optimal number of executable network infer requests.
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get a peak size in bytes of memory arenas holding intermediate, input and output tensors
+ * of the executable network and its infer requests. String value is "PEAK_MEMORY_ARENA_SIZE"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(PEAK_MEMORY_ARENA_SIZE, uint64_t);
+
+/**
+ * @brief Metric to get sizes in bytes of the memory workspace for intermediate tensors of the executable network.
+ *
+ * "SOLVED_SIZE" is the size of the workspace found by the memory solver and "LOWER_BOUND" is the maximal total size
+ * of tensors alive at the same time, so no packing can do better. String value is "MEMORY_SOLVER_STATISTICS"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MEMORY_SOLVER_STATISTICS, std::map<std::string, uint64_t>);
+
 }  // namespace Metrics
 
 /**
@@ -219,6 +243,60 @@ DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
 DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 
+/**
+ * @brief Enables execution of independent branches of a network in parallel on the CPU.
+ *
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default)
+ * The option helps latency of multi-branch topologies whose layers are too small to load all the cores.
+ * It has effect only if the OpenVINO is compiled with TBB threading.
+ */
+DECLARE_CONFIG_KEY(CPU_INTER_OP_PARALLEL);
+
+/**
+ * @brief Selects how intermediate tensors are packed into the memory workspace on the CPU.
+ *
+ * It is passed to Core::SetConfig() or Core::LoadNetwork(), this option should be used with values:
+ * - CPU_MEMORY_SOLVER_GREEDY (default) places the biggest tensors first, each one above all tensors alive at the same time
+ * - CPU_MEMORY_SOLVER_BEST_FIT tries several placement orders and puts each tensor into the tightest
+ *   free gap, it takes longer on LoadNetwork but usually gives a smaller workspace
+ */
+DECLARE_CONFIG_VALUE(CPU_MEMORY_SOLVER_GREEDY);
+DECLARE_CONFIG_VALUE(CPU_MEMORY_SOLVER_BEST_FIT);
+DECLARE_CONFIG_KEY(CPU_MEMORY_SOLVER);
+
+/**
+ * @brief Enables code generation for chains of elementwise layers on the CPU.
+ *
+ * It is passed to Core::SetConfig() or Core::LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default)
+ * Supported FP32 elementwise subgraphs are compiled into a single kernel each, so intermediate tensors
+ * are kept in registers instead of being written to memory.
+ */
+DECLARE_CONFIG_KEY(CPU_SNIPPETS);
+
+/**
+ * @brief The number of input shape configurations the CPU plugin keeps compiled graphs for.
+ *
+ * It is passed to Core::SetConfig() or Core::LoadNetwork(), the value is a non-negative integer, 0 (default)
+ * disables the cache. When enabled, an infer request whose input blobs have dims other than the loaded
+ * network reshapes a copy of the network and compiles it once, the least recently used graphs are released.
+ * Weights are shared between the graphs. Default output blobs follow the dims of the graph outputs, output blobs
+ * set by the user must have the output dims for the input shapes. Not applied with dynamic batch and for networks
+ * with states.
+ */
+DECLARE_CONFIG_KEY(CPU_SHAPE_CACHE_CAPACITY);
+
+/**
+ * @brief Places the graphs, the infer requests and their blobs of the CPU streams on the NUMA nodes of the streams.
+ *
+ * It is passed to Core::SetConfig() or Core::LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default)
+ * Applied with several streams bound to NUMA nodes on a host with several nodes. Infer requests are spread over
+ * the nodes, graphs and blob memory are first touched by the threads of their node.
+ */
+DECLARE_CONFIG_KEY(CPU_NUMA_PLACEMENT);
+
 /**
  * @brief Optimize GPU plugin execution to maximize throughput.
  *
@@ -372,6 +450,8 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
 * The key might enable caching for all plugin or some specific ones, e.g.:
 * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}}) - enables cache for all plugins that might want to use it
 * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}}, {"GPU"}) - enables cache only for GPU plugin
+* For devices which report METRIC_KEY(IMPORT_EXPORT_SUPPORT) Core also stores compiled networks in the cache
+* directory and imports them on subsequent LoadNetwork calls with the same network, device and config
 */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
@@ -11,6 +11,10 @@
 
 #pragma once
 
+#include <cstdint>
+#include <map>
+#include <string>
+
 #include "ie_plugin_config.hpp"
 
 namespace InferenceEngine {
@@ -34,5 +38,39 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief Scheduling policy config option, which defines how requests are distributed between the devices:
+ * - MULTI_PRIORITY_ORDER (default) sends a request to the first device in the priority list having an idle request
+ * - MULTI_EXPECTED_FINISH_TIME sends a request to the device with the lowest expected finish time,
+ *   estimated by the moving average of the device latency and the number of requests queued to the device
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+DECLARE_MULTI_CONFIG_VALUE(PRIORITY_ORDER);
+DECLARE_MULTI_CONFIG_VALUE(EXPECTED_FINISH_TIME);
+
 }  // namespace MultiDeviceConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric to get a std::map<std::string, uint64_t> with number of inference requests completed by each device
+ * of the Multi-Device executable network, String value is "MULTI_COMPLETED_INFER_REQUESTS"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MULTI_COMPLETED_INFER_REQUESTS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get a std::map<std::string, uint64_t> with number of inference requests each device
+ * of the Multi-Device executable network has taken over from the queues of other devices,
+ * String value is "MULTI_STOLEN_INFER_REQUESTS"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MULTI_STOLEN_INFER_REQUESTS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get a std::map<std::string, float> with exponentially weighted moving average of inference latency
+ * in milliseconds measured for each device of the Multi-Device executable network,
+ * String value is "MULTI_AVERAGE_LATENCY"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MULTI_AVERAGE_LATENCY, std::map<std::string, float>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
@@ -0,0 +1,54 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <memory>
+#include <utility>
+
+#include "auto_batch_async_infer_request.hpp"
+
+namespace AutoBatchPlugin {
+    using namespace InferenceEngine;
+
+AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
+    const AutoBatchInferRequest::Ptr&           inferRequest,
+    const AutoBatchExecutableNetwork::Ptr&      autoBatchExecutableNetwork,
+    const ITaskExecutor::Ptr&                   callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(inferRequest, nullptr, callbackExecutor),
+    _autoBatchExecutableNetwork{autoBatchExecutableNetwork},
+    _inferRequest{inferRequest} {
+    // this executor queues the request to the next batch while the task (checking the result) is called
+    // once the batch is executed
+    struct ThisRequestExecutor : public ITaskExecutor {
+        explicit ThisRequestExecutor(AutoBatchAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            auto inferRequest = _this->_inferRequest.get();
+            inferRequest->_status = StatusCode::OK;
+            inferRequest->_exception = nullptr;
+            _this->_autoBatchExecutableNetwork->Enqueue(inferRequest, std::move(task));
+        };
+        AutoBatchAsyncInferRequest* _this = nullptr;
+    };
+    _pipeline = {
+        { /*TaskExecutor*/ std::make_shared<ThisRequestExecutor>(this), /*task*/ [this] {
+              auto status = _inferRequest->_status;
+              if (InferenceEngine::StatusCode::OK != status) {
+                  if (nullptr != _inferRequest->_exception)
+                      std::rethrow_exception(_inferRequest->_exception);
+                  else
+                      THROW_IE_EXCEPTION << InferenceEngine::details::as_status << status;
+              }
+        }}
+    };
+}
+
+void AutoBatchAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
+AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
+    StopAndWait();
+}
+
+}  // namespace AutoBatchPlugin
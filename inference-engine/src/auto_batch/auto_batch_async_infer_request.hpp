@@ -0,0 +1,31 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <memory>
+
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include "auto_batch_infer_request.hpp"
+#include "auto_batch_exec_network.hpp"
+
+namespace AutoBatchPlugin {
+
+class AutoBatchAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchAsyncInferRequest>;
+
+    explicit AutoBatchAsyncInferRequest(const AutoBatchInferRequest::Ptr&           inferRequest,
+                                        const AutoBatchExecutableNetwork::Ptr&      autoBatchExecutableNetwork,
+                                        const InferenceEngine::ITaskExecutor::Ptr&  callbackExecutor);
+    void Infer_ThreadUnsafe() override;
+    ~AutoBatchAsyncInferRequest() override;
+
+protected:
+    AutoBatchExecutableNetwork::Ptr     _autoBatchExecutableNetwork;
+    AutoBatchInferRequest::Ptr          _inferRequest;
+};
+
+}  // namespace AutoBatchPlugin
@@ -0,0 +1,246 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ie_metric_helpers.hpp>
+#include <auto-batch/auto_batch_config.hpp>
+#include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
+#include "auto_batch_async_infer_request.hpp"
+#include "auto_batch_exec_network.hpp"
+
+// ------------------------------AutoBatchExecutableNetwork----------------------------
+namespace AutoBatchPlugin {
+    using namespace InferenceEngine;
+
+AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(const InferenceEngine::ExecutableNetwork&                            networkForDevice,
+                                                       const DeviceInformation&                                             networkDevice,
+                                                       const std::unordered_map<std::string, InferenceEngine::Parameter>&   config,
+                                                       const bool                                                           dynamicBatch,
+                                                       const std::chrono::microseconds                                      timeout) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
+    _networkForDevice{networkForDevice},
+    _device{networkDevice},
+    _config{config},
+    _dynamicBatch{dynamicBatch},
+    _timeout{timeout} {
+    _taskExecutor.reset();
+    unsigned int numRequests = 1u;
+    try {
+        numRequests = std::max(1u, _networkForDevice.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+    } catch (const InferenceEngine::details::InferenceEngineException&) {
+        // a single batch in flight is the only safe assumption for the device
+    }
+    _workerRequests.resize(numRequests);
+    _idleWorkerRequests.reserve(numRequests);
+    for (auto&& workerRequest : _workerRequests) {
+        workerRequest._inferRequest = _networkForDevice.CreateInferRequest();
+        workerRequest._batch.reserve(_device.batchSize);
+        auto* workerRequestPtr = &workerRequest;
+        _idleWorkerRequests.push_back(workerRequestPtr);
+        workerRequest._inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+            [workerRequestPtr, this] (InferRequest , StatusCode status) {
+                FinishBatch(*workerRequestPtr, status);
+            });
+    }
+    _collectingThread = std::thread{&AutoBatchExecutableNetwork::CollectBatches, this};
+}
+
+AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _terminate = true;
+    }
+    _condVar.notify_all();
+    if (_collectingThread.joinable()) {
+        _collectingThread.join();
+    }
+    /* NOTE: The user-facing requests keep the network alive, so nothing is pending at this point.
+     *       The batches started for the last requests may still be returning their workers to the idle list
+     */
+    {
+        std::unique_lock<std::mutex> lock{_mutex};
+        _condVar.wait(lock, [&] { return _idleWorkerRequests.size() == _workerRequests.size(); });
+    }
+    _workerRequests.clear();
+}
+
+void AutoBatchExecutableNetwork::Enqueue(AutoBatchInferRequest* request, Task task) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _pendingRequests.push_back({request, std::move(task), std::chrono::steady_clock::now()});
+    // the collecting thread waits either for the first request or for the full batch
+    const auto numPending = _pendingRequests.size();
+    if (1 == numPending || static_cast<std::size_t>(_device.batchSize) == numPending) {
+        _condVar.notify_all();
+    }
+}
+
+void AutoBatchExecutableNetwork::CollectBatches() {
+    const auto batchSize = static_cast<std::size_t>(_device.batchSize);
+    std::unique_lock<std::mutex> lock{_mutex};
+    for (;;) {
+        _condVar.wait(lock, [&] { return _terminate || (!_pendingRequests.empty() && !_idleWorkerRequests.empty()); });
+        if (_terminate) {
+            return;
+        }
+        // keep on collecting until the batch is full or the first request runs out of its latency budget
+        const auto deadline = _pendingRequests.front()._enqueueTime + _timeout;
+        _condVar.wait_until(lock, deadline, [&] { return _terminate || _pendingRequests.size() >= batchSize; });
+        if (_terminate) {
+            return;
+        }
+        auto workerRequest = _idleWorkerRequests.back();
+        _idleWorkerRequests.pop_back();
+        const auto numRequests = std::min(batchSize, _pendingRequests.size());
+        for (std::size_t i = 0; i < numRequests; ++i) {
+            workerRequest->_batch.push_back(std::move(_pendingRequests.front()));
+            _pendingRequests.pop_front();
+        }
+        lock.unlock();
+        StartBatch(*workerRequest);
+        lock.lock();
+    }
+}
+
+void AutoBatchExecutableNetwork::StartBatch(WorkerInferRequest& workerRequest) {
+    workerRequest._startTime = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < workerRequest._batch.size(); ++i) {
+        auto request = workerRequest._batch[i]._request;
+        try {
+            request->CopyInputsTo(workerRequest._inferRequest, i);
+        } catch (...) {
+            // only this request fails, its item of the batch is computed from the stale data and then dropped
+            request->_status = GENERAL_ERROR;
+            request->_exception = std::current_exception();
+        }
+    }
+    try {
+        if (_dynamicBatch) {
+            workerRequest._inferRequest.SetBatch(static_cast<int>(workerRequest._batch.size()));
+        }
+        workerRequest._inferRequest.StartAsync();
+    } catch (...) {
+        InferenceEngine::CurrentException() = std::current_exception();
+        FinishBatch(workerRequest, GENERAL_ERROR);
+        InferenceEngine::CurrentException() = nullptr;
+    }
+}
+
+void AutoBatchExecutableNetwork::FinishBatch(WorkerInferRequest& workerRequest, StatusCode status) {
+    auto exception = InferenceEngine::CurrentException();
+    std::uint64_t queueingDelayUs = 0;
+    for (std::size_t i = 0; i < workerRequest._batch.size(); ++i) {
+        auto& pendingRequest = workerRequest._batch[i];
+        auto request = pendingRequest._request;
+        queueingDelayUs += std::chrono::duration_cast<std::chrono::microseconds>(
+            workerRequest._startTime - pendingRequest._enqueueTime).count();
+        if (OK != status) {
+            request->_status = status;
+            request->_exception = exception;
+        } else if (OK == request->_status) {
+            try {
+                request->CopyOutputsFrom(workerRequest._inferRequest, i);
+            } catch (...) {
+                request->_status = GENERAL_ERROR;
+                request->_exception = std::current_exception();
+            }
+        }
+    }
+    {
+        // the counters are read together, so they are updated at once
+        std::lock_guard<std::mutex> lock{_mutex};
+        _numBatchedRequests += workerRequest._batch.size();
+        _queueingDelayUs += queueingDelayUs;
+        _numCompletedBatches++;
+    }
+    for (auto&& pendingRequest : workerRequest._batch) {
+        auto capturedTask = std::move(pendingRequest._task);
+        capturedTask();
+    }
+    workerRequest._batch.clear();
+    std::lock_guard<std::mutex> lock{_mutex};
+    _idleWorkerRequests.push_back(&workerRequest);
+    // notifying under the lock, as the destructor may be waiting for the last worker
+    _condVar.notify_all();
+}
+
+InferenceEngine::InferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                                              InferenceEngine::OutputsDataMap networkOutputs) {
+    return std::make_shared<AutoBatchInferRequest>(networkInputs, networkOutputs);
+}
+
+IInferRequest::Ptr AutoBatchExecutableNetwork::CreateInferRequest() {
+    IInferRequest::Ptr asyncRequest;
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    auto asyncTreadSafeImpl = std::make_shared<AutoBatchAsyncInferRequest>(std::static_pointer_cast<AutoBatchInferRequest>(syncRequestImpl),
+                                                                           std::static_pointer_cast<AutoBatchExecutableNetwork>(shared_from_this()),
+                                                                           _callbackExecutor);
+    asyncRequest.reset(new InferRequestBase(asyncTreadSafeImpl));
+    asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
+    return asyncRequest;
+}
+
+void AutoBatchExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) {
+    THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "The BATCH device does not support the network's SetConfig, "
+                       << "the batch size and the timeout are fixed at the LoadNetwork time";
+}
+
+InferenceEngine::Parameter AutoBatchExecutableNetwork::GetConfig(const std::string &name) const {
+    auto it = _config.find(name);
+    if (it != _config.end()) {
+        return it->second;
+    } else {
+        return _networkForDevice.GetConfig(name);
+    }
+}
+
+InferenceEngine::Parameter AutoBatchExecutableNetwork::GetMetric(const std::string &name) const {
+    if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        // enough requests to fill the batches of all the workers
+        unsigned int res = static_cast<unsigned int>(_device.batchSize * _workerRequests.size());
+        IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, res);
+    } else if (name == METRIC_KEY(NETWORK_NAME)) {
+        IE_SET_METRIC_RETURN(NETWORK_NAME, _networkForDevice.GetMetric(
+            METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(SUPPORTED_METRICS),
+            METRIC_KEY(NETWORK_NAME),
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(AUTO_BATCH_AVERAGE_BATCH_SIZE),
+            METRIC_KEY(AUTO_BATCH_AVERAGE_QUEUEING_DELAY),
+            METRIC_KEY(AUTO_BATCH_COMPLETED_BATCHES)
+        });
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys = {
+            AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE,
+            AutoBatchConfigParams::KEY_AUTO_BATCH_SIZE,
+            AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT};
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else if (name == METRIC_KEY(AUTO_BATCH_AVERAGE_BATCH_SIZE)) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        float averageBatchSize = _numCompletedBatches ? static_cast<float>(_numBatchedRequests) / _numCompletedBatches : 0.f;
+        IE_SET_METRIC_RETURN(AUTO_BATCH_AVERAGE_BATCH_SIZE, averageBatchSize);
+    } else if (name == METRIC_KEY(AUTO_BATCH_AVERAGE_QUEUEING_DELAY)) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        float averageDelay = _numBatchedRequests ? static_cast<float>(_queueingDelayUs) / _numBatchedRequests / 1000.f : 0.f;
+        IE_SET_METRIC_RETURN(AUTO_BATCH_AVERAGE_QUEUEING_DELAY, averageDelay);
+    } else if (name == METRIC_KEY(AUTO_BATCH_COMPLETED_BATCHES)) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        IE_SET_METRIC_RETURN(AUTO_BATCH_COMPLETED_BATCHES, _numCompletedBatches);
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
+    }
+}
+
+}  // namespace AutoBatchPlugin
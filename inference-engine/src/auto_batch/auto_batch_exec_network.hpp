@@ -0,0 +1,93 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <threading/ie_itask_executor.hpp>
+#include "auto_batch_infer_request.hpp"
+
+namespace AutoBatchPlugin {
+
+struct DeviceInformation {
+    std::string                         deviceName;
+    std::map<std::string, std::string>  config;
+    int                                 batchSize;
+};
+
+/**
+ * @brief Collects the incoming batch-1 requests into batches executed by the requests of the network loaded
+ *        with the batch in the first dimension. A batch is started when it is full or when its first request
+ *        has waited for the timeout, whichever happens first.
+ */
+class AutoBatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchExecutableNetwork>;
+    struct PendingRequest {
+        AutoBatchInferRequest*                  _request;
+        InferenceEngine::Task                   _task;
+        std::chrono::steady_clock::time_point   _enqueueTime;
+    };
+    struct WorkerInferRequest {
+        InferenceEngine::InferRequest           _inferRequest;
+        std::vector<PendingRequest>             _batch;
+        std::chrono::steady_clock::time_point   _startTime;
+    };
+
+    explicit AutoBatchExecutableNetwork(const InferenceEngine::ExecutableNetwork&                           networkForDevice,
+                                        const DeviceInformation&                                            networkDevice,
+                                        const std::unordered_map<std::string, InferenceEngine::Parameter>&  config,
+                                        const bool                                                          dynamicBatch,
+                                        const std::chrono::microseconds                                     timeout);
+
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) override;
+    InferenceEngine::Parameter GetConfig(const std::string &name) const override;
+    InferenceEngine::Parameter GetMetric(const std::string &name) const override;
+    InferenceEngine::IInferRequest::Ptr CreateInferRequest() override;
+    InferenceEngine::InferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                      InferenceEngine::OutputsDataMap networkOutputs) override;
+    ~AutoBatchExecutableNetwork() override;
+
+    // the task is called once the request is executed as a part of some batch (or the batch failed)
+    void Enqueue(AutoBatchInferRequest* request, InferenceEngine::Task task);
+
+protected:
+    void CollectBatches();
+    void StartBatch(WorkerInferRequest& workerRequest);
+    void FinishBatch(WorkerInferRequest& workerRequest, InferenceEngine::StatusCode status);
+
+    InferenceEngine::ExecutableNetwork                              _networkForDevice;
+    DeviceInformation                                               _device;
+    std::unordered_map<std::string, InferenceEngine::Parameter>     _config;
+    bool                                                            _dynamicBatch = false;
+    std::chrono::microseconds                                       _timeout;
+    // the vector is never resized once created, as the completion callbacks keep pointers to its elements
+    std::vector<WorkerInferRequest>                                 _workerRequests;
+    std::vector<WorkerInferRequest*>                                _idleWorkerRequests;
+    std::deque<PendingRequest>                                      _pendingRequests;
+    mutable std::mutex                                              _mutex;
+    std::condition_variable                                         _condVar;
+    bool                                                            _terminate = false;
+    std::thread                                                     _collectingThread;
+
+    // the statistics below are guarded by _mutex
+    std::uint64_t                                                   _numCompletedBatches = 0;
+    std::uint64_t                                                   _numBatchedRequests = 0;
+    std::uint64_t                                                   _queueingDelayUs = 0;
+};
+
+}  // namespace AutoBatchPlugin
@@ -0,0 +1,88 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <cstring>
+#include <string>
+
+#include <blob_factory.hpp>
+#include "auto_batch_infer_request.hpp"
+
+namespace AutoBatchPlugin {
+    using namespace InferenceEngine;
+
+namespace {
+    // copies an item of the batch-1 `desc` shape between the `item` blob of the request and the `batched` blob
+    void CopyItem(const TensorDesc& desc, const std::string& name, const Blob::Ptr& item,
+                  const Blob::Ptr& batched, std::size_t index, bool toBatched) {
+        auto itemMemory = as<MemoryBlob>(item);
+        auto batchedMemory = as<MemoryBlob>(batched);
+        if (nullptr == itemMemory || nullptr == batchedMemory) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "BATCH device supports only memory blobs, the blob '" << name
+                               << "' is not one";
+        }
+        const auto& itemDesc = itemMemory->getTensorDesc();
+        if (itemDesc.getPrecision() != desc.getPrecision() || itemDesc.getLayout() != desc.getLayout() ||
+            itemDesc.getDims() != desc.getDims()) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "BATCH device does not support preprocessing, the blob '" << name
+                               << "' should have the precision, layout and dimensions of the network";
+        }
+        const auto itemSize = itemMemory->byteSize();
+        if (batchedMemory->byteSize() < (index + 1) * itemSize) {
+            THROW_IE_EXCEPTION << "The batched blob '" << name << "' has no room for the item " << index;
+        }
+        if (toBatched) {
+            auto itemHolder = itemMemory->rmap();
+            auto batchedHolder = batchedMemory->wmap();
+            std::memcpy(batchedHolder.as<std::uint8_t*>() + index * itemSize, itemHolder.as<const std::uint8_t*>(), itemSize);
+        } else {
+            auto batchedHolder = batchedMemory->rmap();
+            auto itemHolder = itemMemory->wmap();
+            std::memcpy(itemHolder.as<std::uint8_t*>(), batchedHolder.as<const std::uint8_t*>() + index * itemSize, itemSize);
+        }
+    }
+}  // namespace
+
+// ------------------------------AutoBatchInferRequest----------------------------
+AutoBatchInferRequest::AutoBatchInferRequest(const InputsDataMap&   networkInputs,
+                                             const OutputsDataMap&  networkOutputs)
+        : InferRequestInternal(networkInputs, networkOutputs) {
+    // Allocate all input blobs
+    for (const auto &it : networkInputs) {
+        Layout l = it.second->getLayout();
+        Precision p = it.second->getPrecision();
+        SizeVector dims = it.second->getTensorDesc().getDims();
+
+        TensorDesc desc = TensorDesc(p, dims, l);
+        _inputs[it.first] = make_blob_with_precision(desc);
+        _inputs[it.first]->allocate();
+    }
+    // Allocate all output blobs
+    for (const auto &it : networkOutputs) {
+        Layout l = it.second->getLayout();
+        Precision p = it.second->getPrecision();
+        SizeVector dims = it.second->getTensorDesc().getDims();
+
+        TensorDesc desc = TensorDesc(p, dims, l);
+        _outputs[it.first] = make_blob_with_precision(desc);
+        _outputs[it.first]->allocate();
+    }
+}
+
+void AutoBatchInferRequest::CopyInputsTo(InferRequest& batchedRequest, std::size_t index) {
+    for (const auto &it : _networkInputs) {
+        auto &name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyItem(it.second->getTensorDesc(), name, GetBlob(name), batchedRequest.GetBlob(name), index, true);
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsFrom(InferRequest& batchedRequest, std::size_t index) {
+    for (const auto &it : _networkOutputs) {
+        auto &name = it.first;
+        CopyItem(it.second->getTensorDesc(), name, GetBlob(name), batchedRequest.GetBlob(name), index, false);
+    }
+}
+
+}  // namespace AutoBatchPlugin
@@ -0,0 +1,36 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <exception>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
+
+namespace AutoBatchPlugin {
+
+class AutoBatchInferRequest : public InferenceEngine::InferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<AutoBatchInferRequest>;
+    explicit AutoBatchInferRequest(const InferenceEngine::InputsDataMap&  networkInputs,
+                                   const InferenceEngine::OutputsDataMap& networkOutputs);
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override {
+        THROW_IE_EXCEPTION_WITH_STATUS(NOT_IMPLEMENTED);
+    }
+    void InferImpl() override {
+        THROW_IE_EXCEPTION_WITH_STATUS(NOT_IMPLEMENTED);
+    }
+    // Auto-Batching impl specific: copies the data of this request to/from the `index` item of the batched request
+    void CopyInputsTo(InferenceEngine::InferRequest& batchedRequest, std::size_t index);
+    void CopyOutputsFrom(InferenceEngine::InferRequest& batchedRequest, std::size_t index);
+
+    InferenceEngine::StatusCode _status = InferenceEngine::StatusCode::OK;
+    std::exception_ptr          _exception = nullptr;
+};
+
+}  // namespace AutoBatchPlugin
@@ -0,0 +1,243 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <ie_metric_helpers.hpp>
+#include <ie_ngraph_utils.hpp>
+#include <auto-batch/auto_batch_config.hpp>
+#include "auto_batch_plugin.hpp"
+
+// ------------------------------AutoBatchInferencePlugin----------------------------
+namespace AutoBatchPlugin {
+    using namespace InferenceEngine;
+namespace {
+    std::map<std::string, std::string> mergeConfigs(std::map<std::string, std::string> config,
+                                                    const std::map<std::string, std::string> & local) {
+        for (auto && kvp : local) {
+            config[kvp.first] = kvp.second;
+        }
+        return config;
+    }
+
+    int ParsePositiveInt(const std::string& key, const std::string& value) {
+        int result = 0;
+        try {
+            result = std::stoi(value);
+        } catch (const std::exception&) {
+            THROW_IE_EXCEPTION << "Wrong value " << value << " for property key " << key << ". Expected positive integer";
+        }
+        if (result <= 0) {
+            THROW_IE_EXCEPTION << "Wrong value " << value << " for property key " << key << ". Expected positive integer";
+        }
+        return result;
+    }
+
+    const int defaultBatchSize = 8;
+    const int defaultTimeoutMs = 1;
+}  // namespace
+
+std::map<std::string, std::string> AutoBatchInferencePlugin::GetSupportedConfig(
+    const std::map<std::string, std::string> & config, const std::string & deviceName) const {
+    std::vector<std::string> supportedConfigKeys = GetCore()->GetMetric(deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    std::map<std::string, std::string> supportedConfig;
+    for (auto&& key : supportedConfigKeys) {
+        auto itKey = config.find(key);
+        if (config.end() != itKey) {
+            supportedConfig[key] = itKey->second;
+        }
+    }
+    return supportedConfig;
+}
+
+DeviceInformation AutoBatchInferencePlugin::ParseMetaDevice(const std::string& deviceBatch,
+                                                            const std::map<std::string, std::string> & config) const {
+    // the device is followed by an optional batch size in brackets, e.g. "CPU(16)"
+    auto openingBracket = deviceBatch.find_first_of('(');
+    auto closingBracket = deviceBatch.find_first_of(')', openingBracket);
+    auto deviceWithID = deviceBatch.substr(0, openingBracket);
+
+    int batchSize = defaultBatchSize;
+    auto itBatchSize = config.find(AutoBatchConfigParams::KEY_AUTO_BATCH_SIZE);
+    if (itBatchSize != config.end()) {
+        batchSize = ParsePositiveInt(itBatchSize->first, itBatchSize->second);
+    }
+    if (closingBracket != std::string::npos && openingBracket < closingBracket) {
+        batchSize = ParsePositiveInt(AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE,
+                                     deviceBatch.substr(openingBracket + 1, closingBracket - openingBracket - 1));
+    }
+
+    DeviceIDParser deviceParser(deviceWithID);
+    std::string deviceName = deviceParser.getDeviceName();
+    std::map<std::string, std::string> tconfig = mergeConfigs(_config, config);
+
+    // set device ID if any
+    std::string deviceIDLocal = deviceParser.getDeviceID();
+    if (!deviceIDLocal.empty()) {
+        tconfig[PluginConfigParams::KEY_DEVICE_ID] = deviceIDLocal;
+    }
+
+    return { deviceName, GetSupportedConfig(tconfig, deviceName), batchSize };
+}
+
+InferenceEngine::Parameter AutoBatchInferencePlugin::GetConfig(const std::string& name,
+        const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    auto it = _config.find(name);
+    if (name == AUTO_BATCH_CONFIG_KEY(DEVICE)) {
+        if (it == _config.end()) {
+            THROW_IE_EXCEPTION << "Value for KEY_AUTO_BATCH_DEVICE is not set";
+        } else {
+            return { it->second };
+        }
+    } else if (name == AUTO_BATCH_CONFIG_KEY(SIZE)) {
+        return { it == _config.end() ? std::to_string(defaultBatchSize) : it->second };
+    } else if (name == AUTO_BATCH_CONFIG_KEY(TIMEOUT)) {
+        return { it == _config.end() ? std::to_string(defaultTimeoutMs) : it->second };
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported config key: " << name;
+    }
+}
+
+void AutoBatchInferencePlugin::SetConfig(const std::map<std::string, std::string> & config) {
+    for (auto && kvp : config) {
+        _config[kvp.first] = kvp.second;
+    }
+}
+
+static const Version version = {{2, 1}, CI_BUILD_NUMBER, "AutoBatchPlugin"};
+IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
+
+AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
+    _pluginName = "BATCH";
+}
+
+InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics;
+        metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
+        metrics.push_back(METRIC_KEY(FULL_DEVICE_NAME));
+        metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
+    } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
+        std::string device_name = { "BATCH" };
+        IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, device_name);
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys = {
+            AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE,
+            AutoBatchConfigParams::KEY_AUTO_BATCH_SIZE,
+            AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT};
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported metric key " << name;
+    }
+}
+
+ExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(const CNNNetwork &network,
+                                                                            const std::map<std::string, std::string>& config) {
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with BATCH device via InferencEngine::Core object";
+    }
+
+    if (network.getFunction() == nullptr) {
+        THROW_IE_EXCEPTION << "BATCH device supports just ngraph network representation";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto device = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE);
+    if (device == fullConfig.end()) {
+        THROW_IE_EXCEPTION << "KEY_AUTO_BATCH_DEVICE key is not set for BATCH device";
+    }
+    auto metaDevice = ParseMetaDevice(device->second, fullConfig);
+
+    int timeoutMs = defaultTimeoutMs;
+    auto itTimeout = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT);
+    if (itTimeout != fullConfig.end()) {
+        timeoutMs = ParsePositiveInt(itTimeout->first, itTimeout->second);
+    }
+
+    // the requests are collected along the first dimension, which is reshaped from 1 to the batch size
+    auto inputShapes = network.getInputShapes();
+    for (auto&& input : inputShapes) {
+        if (input.second.empty() || 1 != input.second[0]) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "BATCH device supports only networks with the batch 1 "
+                               << "in the first dimension, while the input '" << input.first << "' does not have it";
+        }
+        input.second[0] = metaDevice.batchSize;
+    }
+    for (auto&& output : network.getOutputsInfo()) {
+        const auto& dims = output.second->getTensorDesc().getDims();
+        if (dims.empty() || 1 != dims[0]) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "BATCH device supports only networks with the batch 1 "
+                               << "in the first dimension, while the output '" << output.first << "' does not have it";
+        }
+    }
+
+    auto batchedNetwork = InferenceEngine::details::cloneNetwork(network);
+    batchedNetwork.reshape(inputShapes);
+    for (auto&& output : batchedNetwork.getOutputsInfo()) {
+        const auto& dims = output.second->getTensorDesc().getDims();
+        if (dims.empty() || static_cast<std::size_t>(metaDevice.batchSize) != dims[0]) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "BATCH device failed to batch the network, the output '"
+                               << output.first << "' does not follow the batch of the inputs";
+        }
+    }
+
+    // the partial batches are not computed in full if the device can limit the batch of the request
+    ExecutableNetwork executableNetwork;
+    bool dynamicBatch = false;
+    std::vector<std::string> supportedConfigKeys = GetCore()->GetMetric(metaDevice.deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    if (std::find(std::begin(supportedConfigKeys), std::end(supportedConfigKeys), PluginConfigParams::KEY_DYN_BATCH_ENABLED)
+        != std::end(supportedConfigKeys)) {
+        auto deviceConfig = metaDevice.config;
+        deviceConfig[PluginConfigParams::KEY_DYN_BATCH_ENABLED] = PluginConfigParams::YES;
+        try {
+            executableNetwork = GetCore()->LoadNetwork(batchedNetwork, metaDevice.deviceName, deviceConfig);
+            dynamicBatch = true;
+        } catch (const InferenceEngine::details::InferenceEngineException&) {
+            // not every network can run with the dynamic batch, the full batches are computed then
+        }
+    }
+    if (!dynamicBatch) {
+        executableNetwork = GetCore()->LoadNetwork(batchedNetwork, metaDevice.deviceName, metaDevice.config);
+    }
+
+    std::unordered_map<std::string, InferenceEngine::Parameter> networkConfig;
+    networkConfig.insert(*device);
+    networkConfig.insert({AutoBatchConfigParams::KEY_AUTO_BATCH_SIZE, std::to_string(metaDevice.batchSize)});
+    networkConfig.insert({AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT, std::to_string(timeoutMs)});
+    return std::make_shared<AutoBatchExecutableNetwork>(executableNetwork,
+                                                        metaDevice,
+                                                        networkConfig,
+                                                        dynamicBatch,
+                                                        std::chrono::milliseconds{timeoutMs});
+}
+
+QueryNetworkResult AutoBatchInferencePlugin::QueryNetwork(const CNNNetwork&                         network,
+                                                          const std::map<std::string, std::string>& config) const {
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with BATCH device via InferencEngine::Core object";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto device = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE);
+    if (device == fullConfig.end()) {
+        THROW_IE_EXCEPTION << "KEY_AUTO_BATCH_DEVICE key is not set for BATCH device";
+    }
+    auto metaDevice = ParseMetaDevice(device->second, fullConfig);
+    auto queryResult = GetCore()->QueryNetwork(network, metaDevice.deviceName, metaDevice.config);
+    for (auto&& layerQr : queryResult.supportedLayersMap) {
+        layerQr.second = GetName();
+    }
+    return queryResult;
+}
+
+}  // namespace AutoBatchPlugin
@@ -2,12 +2,16 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <limits>
 #include <cstdint>
 #include <cstdio>
 #include <gna_plugin_log.hpp>
 
+#include <ie_parallel.hpp>
+
 #include "cnn.h"
+#include "floatmath_dot.hpp"
 #include "backend/dnn_types.h"
 #include "backend/gna_limitations.hpp"
 #include "gna_lib_ver_selector.hpp"
@@ -32,17 +36,19 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
-    for (uint32_t j = 0; j < num_filter_outputs; j++) {
-        float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
-        for (uint32_t i = 0; i < component->op.conv1D.num_filters; i++) {
-            float *ptr_coef = ptr_filters + i * num_filter_coefficients;
-            float sum = ptr_biases[i];
-            for (uint32_t k = 0; k < num_filter_coefficients; k++) {
-                sum += ptr_in[k] * ptr_coef[k];
-            }
-            ptr_outputs[j * component->op.conv1D.num_filters + i] = sum;
+    const uint32_t num_filters = component->op.conv1D.num_filters;
+    // the output positions are split between threads, each one applies all the filters to its positions
+    InferenceEngine::parallel_nt(0, [&](const int ithr, const int nthr) {
+        uint32_t start = 0, end = 0;
+        InferenceEngine::splitter(num_filter_outputs, nthr, ithr, start, end);
+        for (uint32_t j = start; j < end; j++) {
+            std::copy(ptr_biases, ptr_biases + num_filters, ptr_outputs + j * num_filters);
         }
-    }
+        if (start < end)
+            GNAPluginNS::runtime::XARCH::dot_rows(ptr_filters, num_filter_coefficients, num_filters,
+                                                  ptr_inputs + start * num_inputs_band_stride, num_inputs_band_stride, end - start,
+                                                  num_filter_coefficients, ptr_outputs + start * num_filters, 1, num_filters);
+    });
 }
 
 void CNNMaxPool(intel_dnn_component_t *component, intel_dnn_number_type_t number_type) {
@@ -137,49 +143,12 @@ T getQubeIndex(T a1, T a2, T a3, T A2, T A3) {
     return a1 * A2 * A3 + a2 * A3 + a3;
 }
 
-bool matchesPaddedArea(unsigned filterIndex, unsigned outputIndex, unsigned inputSize, unsigned paddingSize, unsigned stride) {
-    const auto paddedIndex = stride * outputIndex + filterIndex;
-    if (paddedIndex >= inputSize + 2 * paddingSize) {
-        THROW_GNA_EXCEPTION << "In: isZeroPaddingCase, paddedIndex >= inputSize + 2 * paddingSize";
-    }
-    if (paddedIndex < paddingSize || paddedIndex >= inputSize + paddingSize) {
-        return true;
-    }
-    return false;
-}
-
-float CNN2DFilter32SingleHWC(const float bias, const float* filter, const unsigned KH, const unsigned KW, const unsigned KC,
-    const float* image, const unsigned IH, const unsigned IW, const unsigned IC,
-    const unsigned oh, const unsigned ow, const unsigned oc,
-    const std::array<uint32_t, 2>& convStride,
-    const std::array<uint32_t, 2>& zeroPadding) {
-
-    const auto cSH = convStride[0];
-    const auto cSW = convStride[1];
-
-    const auto zPH = zeroPadding[0];
-    const auto zPW = zeroPadding[1];
-    float output = 0;
-    for (unsigned kh = 0; kh < KH; kh++) {
-        for (unsigned kw = 0; kw < KW; kw++) {
-            for (unsigned kc = 0; kc < KC; kc++) {
-                if (!matchesPaddedArea(kh, oh, IH, zPH, cSH) &&
-                    !matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
-                    const auto ih = (cSH * oh + kh) - zPH;
-                    const auto iw = (cSW * ow + kw) - zPW;
-                    const auto ic = kc;
-                    const auto imageIndex = getQubeIndex(ih, iw, ic, IW, IC);
-                    const auto imageElement = image[imageIndex];
-                    const auto filterIndex = getQubeIndex(kh, kw, kc, KW, KC);
-                    const auto filterElement = filter[filterIndex];
-                    const auto product = imageElement * filterElement;
-                    output += product;
-                }
-            }
-        }
-    }
-    output += bias;
-    return output;
+// returns the range [first, last) of the filter taps which fall into the input, the rest are in the zero padding
+void tapsInsideInput(const unsigned outputIndex, const unsigned filterSize, const unsigned inputSize,
+                     const unsigned paddingSize, const unsigned stride, unsigned& first, unsigned& last) {
+    const auto tapZeroIndex = static_cast<int64_t>(stride) * outputIndex - paddingSize;
+    first = static_cast<unsigned>(std::min<int64_t>(std::max<int64_t>(-tapZeroIndex, 0), filterSize));
+    last = static_cast<unsigned>(std::max<int64_t>(std::min<int64_t>(inputSize - tapZeroIndex, filterSize), first));
 }
 
 void CNN2DFilter32(intel_dnn_component_t* component) {
@@ -210,21 +179,43 @@ void CNN2DFilter32(intel_dnn_component_t* component) {
     if (kc != IC) {
         THROW_GNA_EXCEPTION << "Depth of filter should be equal to input depth!" << layer_name;
     }
-    auto kernelIndex = 0;
-    for (unsigned oc = 0; oc < OC; oc++) {
-        for (unsigned ow = 0; ow < OW; ow++) {
-            for (unsigned oh = 0; oh < OH; oh++) {
-                const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
-                ptr_outputs[outputIndex] = CNN2DFilter32SingleHWC(*(ptr_biases + oc), ptr_filters + kernelIndex, kh, kw, kc,
-                    ptr_inputs, IH, IW, IC,
-                    oh, ow, oc,
-                    component->op.conv2D.convStride,
-                    component->op.conv2D.zeroPadding);
+
+    const auto cSH = component->op.conv2D.convStride[0];
+    const auto cSW = component->op.conv2D.convStride[1];
+    const auto zPH = component->op.conv2D.zeroPadding[0];
+    const auto zPW = component->op.conv2D.zeroPadding[1];
+    if (OH == 0 || OW == 0) {
+        return;
+    }
+    if (cSH * (OH - 1) + kh > IH + 2 * zPH || cSW * (OW - 1) + kw > IW + 2 * zPW) {
+        THROW_GNA_EXCEPTION << "The filter exceeds the padded input!" << layer_name;
+    }
+    // kernel padded to 16B = 4 * sizeof(float)
+    const auto kernelStride = ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
+
+    // The output pixels are split between threads, each pixel gets all the filters. The taps of a filter row
+    // inside the input are adjacent both in the filter and in the input, so they make a single dot product
+    InferenceEngine::parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(static_cast<size_t>(OH) * OW, nthr, ithr, start, end);
+        for (size_t pixel = start; pixel < end; pixel++) {
+            const auto oh = static_cast<uint32_t>(pixel / OW);
+            const auto ow = static_cast<uint32_t>(pixel % OW);
+            float* ptr_out = ptr_outputs + getQubeIndex(oh, ow, 0u, OW, OC);
+            std::copy(ptr_biases, ptr_biases + OC, ptr_out);
+
+            unsigned khFirst = 0, khLast = 0, kwFirst = 0, kwLast = 0;
+            tapsInsideInput(oh, kh, IH, zPH, cSH, khFirst, khLast);
+            tapsInsideInput(ow, kw, IW, zPW, cSW, kwFirst, kwLast);
+            for (unsigned fh = khFirst; fh < khLast; fh++) {
+                const auto ih = (cSH * oh + fh) - zPH;
+                const auto iw = (cSW * ow + kwFirst) - zPW;
+                GNAPluginNS::runtime::XARCH::dot_rows(ptr_filters + getQubeIndex(fh, kwFirst, 0u, kw, kc), kernelStride, OC,
+                                                      ptr_inputs + getQubeIndex(ih, iw, 0u, IW, IC), 0, 1, (kwLast - kwFirst) * kc,
+                                                      ptr_out, 1, 0);
             }
         }
-        // kernel padded to 16B = 4 * sizeof(float)
-        kernelIndex += ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
-    }
+    });
 }
 
 #endif
@@ -1,13 +1,43 @@
 // Copyright (C) 2018-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines, the row-major products without transposition are vectorized
+// and threaded, the rest are unoptimized (for reference)
 //
 
 #include <cstdint>
 #include <cstdio>
+#include <vector>
 
+#include <ie_parallel.hpp>
 #include "floatmath.h"
+#include "floatmath_dot.hpp"
+
+namespace {
+
+// products with fewer multiplications are computed by the calling thread, as waking up the workers costs more
+constexpr size_t parallel_min_ops = 1 << 15;
+
+int num_threads(size_t num_ops) {
+    return num_ops < parallel_min_ops ? 1 : 0;
+}
+
+// returns B (K x N) with the columns stored contiguously, so every output is a dot product of two contiguous vectors
+const float *contiguous_columns(const float *B, const MKL_INT ldb, const MKL_INT K, const MKL_INT N,
+                                std::vector<float> &columns) {
+    if (N == 1 && ldb == 1) {
+        return B;
+    }
+    columns.resize(static_cast<size_t>(N) * K);
+    for (MKL_INT k = 0; k < K; k++) {
+        for (MKL_INT j = 0; j < N; j++) {
+            columns[static_cast<size_t>(j) * K + k] = B[k * ldb + j];
+        }
+    }
+    return columns.data();
+}
+
+}  // namespace
 
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
@@ -27,15 +57,22 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+        std::vector<float> columns;
+        auto B_columns = contiguous_columns(B, ldb, K, N, columns);
+        if (beta != 1.0) {
+            for (i = 0; i < M; i++) {
+                for (j = 0; j < N; j++) {
+                    C[i * ldc + j] = 0;
                 }
-                C[i * ldc + j] = sum;
             }
         }
+        InferenceEngine::parallel_nt(num_threads(static_cast<size_t>(M) * N * K), [&](const int ithr, const int nthr) {
+            MKL_INT start = 0, end = 0;
+            InferenceEngine::splitter(M, nthr, ithr, start, end);
+            if (start < end)
+                GNAPluginNS::runtime::XARCH::dot_rows(A + start * lda, lda, end - start, B_columns, K, N, K,
+                                                      C + start * ldc, ldc, 1);
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
@@ -105,16 +142,23 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+        std::vector<float> columns;
+        auto B_columns = contiguous_columns(B, ldb, K, N, columns);
+        if (beta != 1.0) {
+            for (l = 0; l < L; l++) {
+                for (j = 0; j < N; j++) {
+                    C[l * ldc + j] = 0;
                 }
-                C[l * ldc + j] = sum;
             }
         }
+        InferenceEngine::parallel_nt(num_threads(static_cast<size_t>(L) * N * K), [&](const int ithr, const int nthr) {
+            MKL_INT start = 0, end = 0;
+            InferenceEngine::splitter(L, nthr, ithr, start, end);
+            for (MKL_INT out_row = start; out_row < end; out_row++) {
+                GNAPluginNS::runtime::XARCH::dot_rows(A + OutputList[out_row] * lda, lda, 1, B_columns, K, N, K,
+                                                      C + out_row * ldc, ldc, 1);
+            }
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
@@ -0,0 +1,68 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "floatmath_dot.hpp"
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace XARCH {
+
+namespace {
+
+inline float dot(const float* a, const float* b, size_t size) {
+    size_t k = 0;
+    float sum = 0.0f;
+#if defined(HAVE_AVX512F)
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    for (; k + 32 <= size; k += 32) {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + k), _mm512_loadu_ps(b + k), acc0);
+        acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(a + k + 16), _mm512_loadu_ps(b + k + 16), acc1);
+    }
+    for (; k + 16 <= size; k += 16) {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + k), _mm512_loadu_ps(b + k), acc0);
+    }
+    sum = _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1));
+#elif defined(HAVE_AVX2)
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    for (; k + 16 <= size; k += 16) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + k), _mm256_loadu_ps(b + k), acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + k + 8), _mm256_loadu_ps(b + k + 8), acc1);
+    }
+    for (; k + 8 <= size; k += 8) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + k), _mm256_loadu_ps(b + k), acc0);
+    }
+    __m256 acc = _mm256_add_ps(acc0, acc1);
+    __m128 acc4 = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+    acc4 = _mm_add_ps(acc4, _mm_movehl_ps(acc4, acc4));
+    acc4 = _mm_add_ss(acc4, _mm_movehdup_ps(acc4));
+    sum = _mm_cvtss_f32(acc4);
+#endif
+    for (; k < size; k++) {
+        sum += a[k] * b[k];
+    }
+    return sum;
+}
+
+}  // namespace
+
+void dot_rows(const float* rows, size_t row_stride, size_t num_rows,
+              const float* vecs, size_t vec_stride, size_t num_vecs, size_t size,
+              float* out, size_t out_row_stride, size_t out_vec_stride) {
+    for (size_t i = 0; i < num_rows; i++) {
+        const float* row = rows + i * row_stride;
+        for (size_t v = 0; v < num_vecs; v++) {
+            out[i * out_row_stride + v * out_vec_stride] += dot(row, vecs + v * vec_stride, size);
+        }
+    }
+}
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
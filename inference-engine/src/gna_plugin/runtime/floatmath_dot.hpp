@@ -0,0 +1,31 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+#include <ie_system_conf.h>
+
+namespace GNAPluginNS {
+namespace runtime {
+
+// the dispatcher generated by cross_compiled_file() checks the host instruction sets in this namespace
+using InferenceEngine::with_cpu_x86_avx2;
+using InferenceEngine::with_cpu_x86_avx512f;
+
+namespace XARCH {
+
+/**
+ * @brief Adds dot products of `size` elements of every row with every vector to the outputs:
+ *        out[i * out_row_stride + v * out_vec_stride] += dot(rows + i * row_stride, vecs + v * vec_stride)
+ *        The rows and the vectors are contiguous. A row is multiplied by all the vectors while it is in cache
+ */
+void dot_rows(const float* rows, size_t row_stride, size_t num_rows,
+              const float* vecs, size_t vec_stride, size_t num_vecs, size_t size,
+              float* out, size_t out_row_stride, size_t out_vec_stride);
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
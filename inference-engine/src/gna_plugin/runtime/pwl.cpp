@@ -9,6 +9,9 @@
 #include <limits>
 #include <cstdint>
 #include <algorithm>
+#include <exception>
+#include <mutex>
+#include <ie_parallel.hpp>
 #include "backend/gna_types.h"
 
 #ifdef _NO_MKL_
@@ -951,11 +954,11 @@ void PwlApply32(intel_dnn_component_t *component, uint32_t num_subset_size) {
     }
 }
 
-void PwlApply32(intel_dnn_component_t *component,
-                uint32_t num_row_start,
-                uint32_t num_row_end,
-                uint32_t num_col_start,
-                uint32_t num_col_end) {
+static void PwlApply32Part(intel_dnn_component_t *component,
+                           uint32_t num_row_start,
+                           uint32_t num_row_end,
+                           uint32_t num_col_start,
+                           uint32_t num_col_end) {
     intel_piecewiselinear_t *transform = reinterpret_cast<intel_piecewiselinear_t *>(&component->op.pwl);
     float *ptr_in = reinterpret_cast<float *>(component->ptr_inputs);
     float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
@@ -1110,3 +1113,39 @@ void PwlApply32(intel_dnn_component_t *component,
             THROW_GNA_EXCEPTION << component->original_layer_name << ", Unknown piecewise linear function type: " << transform->func_id.type;
     }
 }
+
+void PwlApply32(intel_dnn_component_t *component,
+                uint32_t num_row_start,
+                uint32_t num_row_end,
+                uint32_t num_col_start,
+                uint32_t num_col_end) {
+    const uint32_t num_rows = num_row_end - num_row_start + 1;
+    const uint32_t num_cols = num_col_end - num_col_start + 1;
+    if (static_cast<size_t>(num_rows) * num_cols < PWL_PARALLEL_MIN_SIZE) {
+        PwlApply32Part(component, num_row_start, num_row_end, num_col_start, num_col_end);
+        return;
+    }
+    // the rows are split between threads, a single row is split by columns
+    std::exception_ptr exception;
+    std::mutex exception_mutex;
+    InferenceEngine::parallel_nt(0, [&](const int ithr, const int nthr) {
+        const bool split_rows = num_rows > 1;
+        uint32_t start = 0, end = 0;
+        InferenceEngine::splitter(split_rows ? num_rows : num_cols, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+        try {
+            if (split_rows) {
+                PwlApply32Part(component, num_row_start + start, num_row_start + end - 1, num_col_start, num_col_end);
+            } else {
+                PwlApply32Part(component, num_row_start, num_row_end, num_col_start + start, num_col_start + end - 1);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exception_mutex);
+            exception = std::current_exception();
+        }
+    });
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
@@ -18,6 +18,7 @@
 #include <ngraph/pass/constant_folding.hpp>
 #include <ngraph/pass/manager.hpp>
 #include <set>
+#include <sstream>
 #include <string>
 
 #include <transformations/utils/utils.hpp>
@@ -226,6 +227,7 @@ StatusCode CNNNetworkNGraphImpl::addOutput(const std::string& layerName, size_t
                 auto result = make_shared<::ngraph::op::Result>(layer->output(outputIndex));
                 result->set_friendly_name(outputName);
                 _ngraph_function->add_results({result});
+                invalidateShapeCache();
 
                 if (_outputData.count(outputName) == 0) {
                     reshape();
@@ -300,9 +302,17 @@ CNNNetworkNGraphImpl::reshape(const std::map<std::string, std::vector<size_t>>&
             }
         }
         if (needReshape) {
-            ngraph::pass::Manager ssr_manager;
-            ssr_manager.register_pass<ngraph::pass::SmartReshape>();
-            ssr_manager.run_passes(_ngraph_function);
+            // SmartReshape makes the function shape agnostic, so running it again finds nothing to change
+            // unless the application added new operations since the last reshape
+            if (updateShapeDependentOps())
+                _smartReshapeApplied = false;
+            if (!_smartReshapeApplied) {
+                ngraph::pass::Manager ssr_manager;
+                ssr_manager.register_pass<ngraph::pass::SmartReshape>();
+                ssr_manager.run_passes(_ngraph_function);
+                invalidateShapeCache();
+                _smartReshapeApplied = true;
+            }
 
             reshape(inputShapes);
         }
@@ -317,21 +327,21 @@ void
 CNNNetworkNGraphImpl::reshape(const std::map<std::string, std::vector<size_t>>& inputShapes) {
     OV_ITT_SCOPED_TASK(itt::domains::IE, "CNNNetworkNGraphImpl::reshape");
 
-    auto params = _ngraph_function->get_parameters();
-
-    bool parameter_replaced = false;
-    for (size_t i = 0; i < params.size(); i++) {
-        const auto& param = params[i];
-        if (inputShapes.find(param->get_friendly_name()) == inputShapes.end())
+    // Parameters are updated in place, so memoized shapes stay bound to the same operations
+    ::ngraph::ParameterVector changedParameters;
+    for (const auto& param : _ngraph_function->get_parameters()) {
+        auto it = inputShapes.find(param->get_friendly_name());
+        if (it == inputShapes.end())
+            continue;
+        ::ngraph::PartialShape shape(it->second);
+        if (param->get_partial_shape().same_scheme(shape))
             continue;
-        ::ngraph::PartialShape shape(inputShapes.at(param->get_friendly_name()));
-        auto newParam = std::make_shared<::ngraph::op::Parameter>(param->get_element_type(), shape);
-        newParam->set_friendly_name(param->get_friendly_name());
-        _ngraph_function->replace_parameter(i, newParam);
-        parameter_replaced = true;
+        param->set_partial_shape(shape);
+        param->validate_and_infer_types();
+        changedParameters.push_back(param);
     }
-    if (parameter_replaced)
-        _ngraph_function->validate_nodes_and_infer_types();
+    if (!changedParameters.empty())
+        inferShapes(changedParameters);
 
     const auto& results = _ngraph_function->get_results();
     bool outputs_are_static = all_of(
@@ -413,6 +423,217 @@ CNNNetworkNGraphImpl::reshape(const std::map<std::string, std::vector<size_t>>&
     }
 }
 
+namespace {
+
+// Writes attributes of an operation to a string to find operations which change them in shape inference
+class AttributeSnapshot : public ::ngraph::AttributeVisitor {
+public:
+    void on_adapter(const std::string& name, ::ngraph::ValueAccessor<void>&) override {
+        // the value can't be read, such attributes are not inferred from input shapes
+        _stream << name << ';';
+    }
+    void on_adapter(const std::string& name, ::ngraph::ValueAccessor<std::string>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ::ngraph::ValueAccessor<bool>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ::ngraph::ValueAccessor<int64_t>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ::ngraph::ValueAccessor<double>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ::ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ::ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ::ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ::ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ::ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ::ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ::ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ::ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ::ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ::ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ::ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        write(name, adapter.get());
+    }
+
+    static std::string get(const std::shared_ptr<::ngraph::Node>& op) {
+        AttributeSnapshot snapshot;
+        op->visit_attributes(snapshot);
+        return snapshot._stream.str();
+    }
+
+private:
+    template <typename T>
+    void write(const std::string& name, const T& value) {
+        _stream << name << '=' << value << ';';
+    }
+    template <typename T>
+    void write(const std::string& name, const std::vector<T>& values) {
+        _stream << name << '=';
+        for (const auto& value : values) {
+            _stream << value << ',';
+        }
+        _stream << ';';
+    }
+
+    std::ostringstream _stream;
+};
+
+}  // namespace
+
+bool CNNNetworkNGraphImpl::updateShapeDependentOps() {
+    const auto& params = _ngraph_function->get_parameters();
+    // The same checks as Function::validate_nodes_and_infer_types does, which is not called on reshape
+    std::map<::ngraph::Variable*, std::pair<int, int>> variables;
+    std::ostringstream unregisteredParameters;
+    // The application may change the function between reshapes, so the dependent operations are collected
+    // every time. The memoized types are valid only while these operations and their inputs are the same.
+    std::vector<std::shared_ptr<::ngraph::Node>> dependentOps;
+    std::vector<::ngraph::Output<::ngraph::Node>> dependentInputs;
+    std::unordered_set<const ::ngraph::Node*> dependent;
+    for (const auto& op : _ngraph_function->get_ordered_ops()) {
+        const bool isParameter = ::ngraph::op::is_parameter(op);
+        const bool isRegistered = std::find(params.begin(), params.end(), op) != params.end();
+        if (isParameter && !isRegistered)
+            unregisteredParameters << op << std::endl;
+        if (const auto& assign = std::dynamic_pointer_cast<::ngraph::op::AssignBase>(op))
+            variables[assign->get_variable().get()].first++;
+        else if (const auto& readValue = std::dynamic_pointer_cast<::ngraph::op::ReadValueBase>(op))
+            variables[readValue->get_variable().get()].second++;
+
+        if (isRegistered || std::any_of(op->inputs().begin(), op->inputs().end(),
+                [&](const ::ngraph::Input<::ngraph::Node>& input) {
+                    return dependent.count(input.get_source_output().get_node()) != 0;
+                })) {
+            dependent.insert(op.get());
+            dependentOps.push_back(op);
+            for (const auto& input : op->inputs()) {
+                dependentInputs.push_back(input.get_source_output());
+            }
+        }
+    }
+    if (!unregisteredParameters.str().empty())
+        THROW_IE_EXCEPTION << "Function references undeclared parameters: " << unregisteredParameters.str();
+    if (!std::all_of(variables.begin(), variables.end(),
+            [](const std::pair<::ngraph::Variable* const, std::pair<int, int>>& variable) {
+                return variable.second.first == 1 && variable.second.second == 1;
+            }))
+        THROW_IE_EXCEPTION << "Function is incorrect. Assign and ReadValue operations must be in pairs on the network.";
+
+    if (dependentOps == _shapeDependentOps && dependentInputs == _shapeDependentInputs)
+        return false;
+    invalidateShapeCache();
+    _shapeDependentOps = std::move(dependentOps);
+    _shapeDependentInputs = std::move(dependentInputs);
+    return true;
+}
+
+void CNNNetworkNGraphImpl::inferShapes(const ::ngraph::ParameterVector& changedParameters) {
+    OV_ITT_SCOPED_TASK(itt::domains::IE, "CNNNetworkNGraphImpl::inferShapes");
+
+    updateShapeDependentOps();
+    size_t numOutputs = 0;
+    for (const auto& op : _shapeDependentOps) {
+        numOutputs += op->get_output_size();
+    }
+
+    std::ostringstream signature;
+    for (const auto& param : _ngraph_function->get_parameters()) {
+        signature << param->get_partial_shape() << ";";
+    }
+    const auto key = signature.str();
+
+    auto cached = std::find_if(_shapeCache.begin(), _shapeCache.end(),
+        [&](const std::pair<std::string, OutputTypes>& item) { return item.first == key; });
+    if (cached != _shapeCache.end() && cached->second.size() != numOutputs) {
+        // an operation got other number of outputs, none of the memoized types can be trusted
+        _shapeCache.clear();
+        cached = _shapeCache.end();
+    }
+    if (cached != _shapeCache.end()) {
+        _shapeCache.splice(_shapeCache.end(), _shapeCache, cached);
+        auto type = cached->second.begin();
+        for (const auto& op : _shapeDependentOps) {
+            // bounds of values were evaluated for the previous shapes
+            op->invalidate_values();
+            // These operations keep the inferred state besides output types: attributes computed from
+            // input shapes (e.g. pads of auto_pad convolutions and poolings), shapes of bodies or variables
+            if (_shapeStatefulOps.count(op.get()) ||
+                std::dynamic_pointer_cast<::ngraph::op::util::SubGraphOp>(op) ||
+                std::dynamic_pointer_cast<::ngraph::op::ReadValueBase>(op) ||
+                std::dynamic_pointer_cast<::ngraph::op::AssignBase>(op)) {
+                op->revalidate_and_infer_types();
+                type += op->get_output_size();
+                continue;
+            }
+            for (size_t i = 0; i < op->get_output_size(); ++i, ++type) {
+                op->set_output_type(i, type->first, type->second);
+            }
+        }
+        return;
+    }
+
+    std::unordered_set<const ::ngraph::Node*> affected;
+    for (const auto& param : changedParameters) {
+        affected.insert(param.get());
+    }
+    for (const auto& op : _shapeDependentOps) {
+        if (affected.count(op.get()))
+            continue;
+        if (std::any_of(op->inputs().begin(), op->inputs().end(),
+                [&](const ::ngraph::Input<::ngraph::Node>& input) {
+                    return affected.count(input.get_source_output().get_node()) != 0;
+                })) {
+            // an operation which changed its attributes once is always revalidated, restoring only output
+            // types would leave the attributes inferred for other shapes
+            const auto attributes = _shapeStatefulOps.count(op.get()) ? std::string() : AttributeSnapshot::get(op);
+            op->revalidate_and_infer_types();
+            if (!_shapeStatefulOps.count(op.get()) && attributes != AttributeSnapshot::get(op))
+                _shapeStatefulOps.insert(op.get());
+            affected.insert(op.get());
+        }
+    }
+
+    OutputTypes types;
+    for (const auto& op : _shapeDependentOps) {
+        for (const auto& output : op->outputs()) {
+            types.emplace_back(output.get_element_type(), output.get_partial_shape());
+        }
+    }
+    if (_shapeCache.size() == _shapeCacheCapacity)
+        _shapeCache.pop_front();
+    _shapeCache.emplace_back(key, std::move(types));
+}
+
+void CNNNetworkNGraphImpl::invalidateShapeCache() {
+    _shapeDependentOps.clear();
+    _shapeDependentInputs.clear();
+    _shapeCache.clear();
+    _shapeStatefulOps.clear();
+}
+
 StatusCode CNNNetworkNGraphImpl::serialize(const std::string& xmlPath,
                                            const std::string& binPath,
                                            ResponseDesc* resp) const noexcept {
@@ -482,6 +703,7 @@ StatusCode CNNNetworkNGraphImpl::setBatchSize(size_t size, ResponseDesc* respons
         ngraph::pass::Manager ssr_manager;
         ssr_manager.register_pass<ngraph::pass::SetBatchSize>();
         ssr_manager.run_passes(_ngraph_function);
+        invalidateShapeCache();
 
         return reshape(inShapes, responseDesc);
     } catch (std::exception& ex) {
@@ -11,7 +11,9 @@
 
 #include <algorithm>
 #include <functional>
+#include <list>
 #include <unordered_map>
+#include <unordered_set>
 #include <map>
 #include <memory>
 #include <string>
@@ -20,6 +22,7 @@
 #include <ngraph/attribute_visitor.hpp>
 #include <ngraph/function.hpp>
 #include <ngraph/node.hpp>
+#include <ngraph/op/parameter.hpp>
 
 #include <cpp/ie_cnn_network.h>
 #include "description_buffer.hpp"
@@ -105,6 +108,40 @@ private:
      */
     void reshape();
     void reshape(const std::map<std::string, std::vector<size_t>>& inputShapes);
+
+    /**
+     * @brief Infers types of operations affected by changed parameters
+     *
+     * Only operations reachable from the changed parameters are revalidated. Inferred output types are
+     * memoized by shapes of all parameters, so switching back to known shapes doesn't run shape inference.
+     *
+     * @param changedParameters parameters which got new shapes
+     */
+    void inferShapes(const ::ngraph::ParameterVector& changedParameters);
+
+    /**
+     * @brief Collects operations which depend on parameters and checks the function as its validation does
+     * @return true if the operations differ from the previously collected ones, memoized shapes are dropped then
+     */
+    bool updateShapeDependentOps();
+
+    /**
+     * @brief Drops memoized shapes, must be called when operations of the function are changed
+     */
+    void invalidateShapeCache();
+
+    using OutputTypes = std::vector<std::pair<::ngraph::element::Type, ::ngraph::PartialShape>>;
+
+    static constexpr size_t _shapeCacheCapacity = 16;
+    // operations which depend on parameters in topological order
+    std::vector<std::shared_ptr<::ngraph::Node>> _shapeDependentOps;
+    // sources of inputs of _shapeDependentOps, a change of them means the function was edited
+    std::vector<::ngraph::Output<::ngraph::Node>> _shapeDependentInputs;
+    // output types of _shapeDependentOps by shapes of parameters, the most recently used are at the end
+    std::list<std::pair<std::string, OutputTypes>> _shapeCache;
+    // operations whose attributes were changed by shape inference, they are revalidated instead of restoring types
+    std::unordered_set<const ::ngraph::Node*> _shapeStatefulOps;
+    bool _smartReshapeApplied = false;
 };
 }  // namespace details
 }  // namespace InferenceEngine
@@ -0,0 +1,160 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compilation_context.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <ostream>
+#include <streambuf>
+
+#include <ie_version.hpp>
+#include <details/ie_exception.hpp>
+#include <transformations/serialize.hpp>
+
+#include "ie_itt.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+template <typename T>
+std::uint64_t hash_combine(std::uint64_t seed, const T& a) {
+    // Hash combine formula from boost
+    return seed ^ (std::hash<T>()(a) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+inline std::uint64_t rotl(std::uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+/**
+ * @brief Hashes the bytes written to the stream instead of keeping them, so serialization of
+ *        large weights does not need memory. The hash does not depend on the sizes of the writes
+ */
+class HashStreamBuf final : public std::streambuf {
+public:
+    std::uint64_t hash() {
+        // the tail is padded with zeros, the total size tells it from the real zeros
+        if (_tailSize != 0) {
+            std::memset(_tail + _tailSize, 0, sizeof(_tail) - _tailSize);
+            update(_tail);
+            _tailSize = 0;
+        }
+        return hash_combine(_hash, _size);
+    }
+
+protected:
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        auto size = static_cast<std::size_t>(n);
+        _size += size;
+        if (_tailSize != 0) {
+            const auto count = std::min(size, sizeof(_tail) - _tailSize);
+            std::memcpy(_tail + _tailSize, s, count);
+            _tailSize += count;
+            s += count;
+            size -= count;
+            if (_tailSize != sizeof(_tail)) {
+                return n;
+            }
+            update(_tail);
+            _tailSize = 0;
+        }
+        for (; size >= sizeof(_tail); s += sizeof(_tail), size -= sizeof(_tail)) {
+            update(s);
+        }
+        std::memcpy(_tail, s, size);
+        _tailSize = size;
+        return n;
+    }
+
+    // the serializer takes offsets of constants from tellp()
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (off != 0 || dir != std::ios_base::cur || !(which & std::ios_base::out)) {
+            return pos_type(off_type(-1));
+        }
+        return pos_type(static_cast<off_type>(_size));
+    }
+
+    int_type overflow(int_type c) override {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            const char ch = traits_type::to_char_type(c);
+            xsputn(&ch, 1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+private:
+    void update(const char* word) {
+        // 64-bit block mixing of MurmurHash3
+        std::uint64_t k;
+        std::memcpy(&k, word, sizeof(k));
+        k *= 0x87c37b91114253d5ULL;
+        k = rotl(k, 31);
+        k *= 0x4cf5ad432745937fULL;
+        _hash ^= k;
+        _hash = rotl(_hash, 27) * 5 + 0x52dce729;
+    }
+
+    std::uint64_t   _hash = 0;
+    std::uint64_t   _size = 0;
+    char            _tail[sizeof(std::uint64_t)];
+    std::size_t     _tailSize = 0;
+};
+
+}  // namespace
+
+std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
+                                                   const std::map<std::string, std::string>& compileOptions) {
+    OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "NetworkCompilationContext::computeHash");
+
+    auto function = network.getFunction();
+    if (!function) {
+        THROW_IE_EXCEPTION << "Only nGraph based networks can be cached";
+    }
+
+    std::uint64_t seed = 0;
+
+    // compiled blobs are not guaranteed to be compatible between releases
+    seed = hash_combine(seed, std::string(GetInferenceEngineVersion()->buildNumber));
+
+    // network topology and weights
+    {
+        HashStreamBuf xmlHash, binHash;
+        std::ostream xmlFile(&xmlHash), binFile(&binHash);
+        ngraph::pass::Serialize serializer(xmlFile, binFile, ngraph::pass::Serialize::Version::IR_V10);
+        serializer.run_on_function(std::const_pointer_cast<ngraph::Function>(function));
+
+        seed = hash_combine(seed, xmlHash.hash());
+        seed = hash_combine(seed, binHash.hash());
+    }
+
+    // inputs / outputs info set by the user
+    for (auto&& input : network.getInputsInfo()) {
+        const auto& preProcess = input.second->getPreProcess();
+        seed = hash_combine(seed, input.first);
+        seed = hash_combine(seed, std::string(input.second->getPrecision().name()));
+        seed = hash_combine(seed, static_cast<int>(input.second->getLayout()));
+        seed = hash_combine(seed, static_cast<int>(preProcess.getResizeAlgorithm()));
+        seed = hash_combine(seed, static_cast<int>(preProcess.getColorFormat()));
+        seed = hash_combine(seed, static_cast<int>(preProcess.getMeanVariant()));
+    }
+    for (auto&& output : network.getOutputsInfo()) {
+        seed = hash_combine(seed, output.first);
+        seed = hash_combine(seed, std::string(output.second->getPrecision().name()));
+        seed = hash_combine(seed, static_cast<int>(output.second->getLayout()));
+    }
+
+    // device name and config, std::map keeps the options ordered
+    for (auto&& option : compileOptions) {
+        seed = hash_combine(seed, option.first);
+        seed = hash_combine(seed, option.second);
+    }
+
+    return std::to_string(seed);
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,28 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <map>
+
+#include <cpp/ie_cnn_network.h>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Computes keys of the compiled networks cache
+ */
+struct NetworkCompilationContext final {
+    /**
+     * @brief Computes a hash of the network content, its inputs / outputs info and the compilation options
+     * @param network A network object with nGraph function
+     * @param compileOptions A device name and device specific config used to compile the network
+     * @return A hash string which can be used as a cache entry id
+     */
+    static std::string computeHash(const CNNNetwork& network,
+                                   const std::map<std::string, std::string>& compileOptions);
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,118 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_cache_manager.hpp"
+
+#include <cstdio>
+#include <chrono>
+#include <random>
+#include <sstream>
+#include <thread>
+
+#include <sys/stat.h>
+#ifdef _WIN32
+# include <direct.h>
+#else
+# include <unistd.h>
+#endif
+
+#include <file_utils.h>
+#include <details/ie_exception.hpp>
+
+namespace InferenceEngine {
+
+namespace {
+
+bool directoryExists(const std::string& path) {
+    struct stat sb;
+    return stat(path.c_str(), &sb) == 0 && (sb.st_mode & S_IFDIR);
+}
+
+void createDirectoryRecursive(const std::string& dirPath) {
+    if (dirPath.empty() || directoryExists(dirPath)) {
+        return;
+    }
+
+    auto pos = dirPath.find_last_of("/\\");
+    if (pos != std::string::npos && pos != 0) {
+        createDirectoryRecursive(dirPath.substr(0, pos));
+    }
+
+#ifdef _WIN32
+    int err = _mkdir(dirPath.c_str());
+#else
+    int err = mkdir(dirPath.c_str(), 0755);
+#endif
+    // the directory might be created by another process in parallel
+    if (err != 0 && !directoryExists(dirPath)) {
+        THROW_IE_EXCEPTION << "Couldn't create cache directory " << dirPath;
+    }
+}
+
+std::string makeUniqueSuffix() {
+    static thread_local std::mt19937_64 generator{std::random_device{}() ^
+        static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count())};
+    std::stringstream suffix;
+#ifdef _WIN32
+    suffix << std::hex << std::this_thread::get_id() << "." << generator();
+#else
+    suffix << std::hex << getpid() << "." << std::this_thread::get_id() << "." << generator();
+#endif
+    return suffix.str();
+}
+
+}  // namespace
+
+FileStorageCacheManager::FileStorageCacheManager(std::string cachePath) : m_cachePath(std::move(cachePath)) {
+    createDirectoryRecursive(m_cachePath);
+}
+
+std::string FileStorageCacheManager::getBlobFile(const std::string& blobHash) const {
+    return FileUtils::makePath(m_cachePath, blobHash + ".blob");
+}
+
+void FileStorageCacheManager::writeCacheEntry(const std::string& id, StreamWriter writer) {
+    auto blobFileName = getBlobFile(id);
+    auto tmpFileName = blobFileName + "." + makeUniqueSuffix() + ".tmp";
+    {
+        std::ofstream stream(tmpFileName, std::ios_base::binary | std::ofstream::out);
+        if (!stream.is_open()) {
+            return;
+        }
+        try {
+            writer(stream);
+        } catch (...) {
+            stream.close();
+            std::remove(tmpFileName.c_str());
+            throw;
+        }
+        stream.flush();
+        if (!stream.good()) {
+            stream.close();
+            std::remove(tmpFileName.c_str());
+            return;
+        }
+    }
+    // rename is atomic, so readers either see a complete blob or do not see it at all
+    if (std::rename(tmpFileName.c_str(), blobFileName.c_str()) != 0) {
+        // e.g. on Windows rename fails if the entry was published by another process meanwhile
+        std::remove(tmpFileName.c_str());
+    }
+}
+
+void FileStorageCacheManager::readCacheEntry(const std::string& id, StreamReader reader) {
+    auto blobFileName = getBlobFile(id);
+    std::ifstream stream(blobFileName, std::ios_base::binary);
+    if (stream.is_open()) {
+        reader(stream);
+    }
+}
+
+void FileStorageCacheManager::removeCacheEntry(const std::string& id) {
+    auto blobFileName = getBlobFile(id);
+    if (FileUtils::fileExist(blobFileName))
+        std::remove(blobFileName.c_str());
+}
+
+}  // namespace InferenceEngine
@@ -8,20 +8,27 @@
 #include <vector>
 #include <istream>
 #include <mutex>
+#include <algorithm>
+#include <functional>
 
 #include <ie_core.hpp>
 #include <multi-device/multi_device_config.hpp>
+#include <auto-batch/auto_batch_config.hpp>
 #include <ngraph/opsets/opset.hpp>
 #include <ngraph/ngraph.hpp>
 #include <ngraph/graph_util.hpp>
 #include <ngraph/pass/constant_folding.hpp>
+#include <ngraph/parallel.hpp>
 
 #include <cpp_interfaces/exception2status.hpp>
 #include "ie_plugin_cpp.hpp"
 #include "ie_plugin_config.hpp"
 #include "ie_itt.hpp"
+#include "ie_parallel.hpp"
 #include "file_utils.h"
 #include "ie_network_reader.hpp"
+#include "ie_cache_manager.hpp"
+#include "compilation_context.hpp"
 #include "xml_parse_utils.h"
 
 using namespace InferenceEngine::PluginConfigParams;
@@ -46,6 +53,9 @@ Parsed<T> parseDeviceNameIntoConfig(const std::string& deviceName, const std::ma
     } else if (deviceName_.find("MULTI:") == 0) {
         deviceName_ = "MULTI";
         config_[InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = deviceName.substr(6);
+    } else if (deviceName_.find("BATCH:") == 0) {
+        deviceName_ = "BATCH";
+        config_[InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE] = deviceName.substr(6);
     } else {
         DeviceIDParser parser(deviceName_);
         deviceName_ = parser.getDeviceName();
@@ -93,6 +103,92 @@ void allowNotImplemented(F && f) {
     } catch (const NotImplemented & ex) { }
 }
 
+bool isMetricSupported(const InferencePlugin& plugin, const std::string& metricName) {
+    try {
+        std::vector<std::string> supportedMetrics = plugin.GetMetric(METRIC_KEY(SUPPORTED_METRICS), {});
+        return std::find(supportedMetrics.begin(), supportedMetrics.end(), metricName) != supportedMetrics.end();
+    } catch (...) {
+        return false;
+    }
+}
+
+bool isConfigKeySupported(const InferencePlugin& plugin, const std::string& key) {
+    try {
+        std::vector<std::string> supportedKeys = plugin.GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), {});
+        return std::find(supportedKeys.begin(), supportedKeys.end(), key) != supportedKeys.end();
+    } catch (...) {
+        return false;
+    }
+}
+
+bool deviceSupportsImportExport(const InferencePlugin& plugin) {
+    return isMetricSupported(plugin, METRIC_KEY(IMPORT_EXPORT_SUPPORT)) &&
+        plugin.GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), {}).as<bool>();
+}
+
+// CACHE_DIR is handled by Core itself and is passed only to plugins which manage their own caches
+std::map<std::string, std::string> filterCacheDir(const InferencePlugin& plugin,
+                                                  const std::map<std::string, std::string>& config) {
+    auto it = config.find(CONFIG_KEY(CACHE_DIR));
+    if (it == config.end() || isConfigKeySupported(plugin, CONFIG_KEY(CACHE_DIR))) {
+        return config;
+    }
+    auto filtered = config;
+    filtered.erase(CONFIG_KEY(CACHE_DIR));
+    return filtered;
+}
+
+std::string configValueToString(const Parameter& value) {
+    if (value.is<std::string>()) {
+        return value.as<std::string>();
+    } else if (value.is<int>()) {
+        return std::to_string(value.as<int>());
+    } else if (value.is<unsigned int>()) {
+        return std::to_string(value.as<unsigned int>());
+    } else if (value.is<bool>()) {
+        return value.as<bool>() ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO);
+    } else if (value.is<float>()) {
+        return std::to_string(value.as<float>());
+    }
+    THROW_IE_EXCEPTION << "Unsupported config value type";
+}
+
+// the config set via Core::SetConfig is applied by the plugin at LoadNetwork as well, so compiled networks
+// are cached for the effective config: values of all supported keys overridden by the LoadNetwork config
+std::map<std::string, std::string> getEffectiveConfig(const InferencePlugin& plugin,
+                                                      const std::map<std::string, std::string>& config) {
+    auto effectiveConfig = config;
+    std::vector<std::string> supportedKeys = plugin.GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), {});
+    for (auto&& key : supportedKeys) {
+        if (key != CONFIG_KEY(CACHE_DIR) && effectiveConfig.find(key) == effectiveConfig.end()) {
+            effectiveConfig[key] = configValueToString(plugin.GetConfig(key, {}));
+        }
+    }
+    return effectiveConfig;
+}
+
+// parallel parts of nGraph (e.g. constant folding, ONNX import) share the threads and limits of the plugins
+// while a Core exists. The backend is installed by the first Core and reset by the last one, so nGraph doesn't
+// call into the threading of a library which may be unloaded
+std::mutex parallelForBackendMutex;
+std::size_t parallelForBackendUsers = 0;
+
+void acquireParallelForBackend() {
+    std::lock_guard<std::mutex> lock(parallelForBackendMutex);
+    if (parallelForBackendUsers++ == 0) {
+        ngraph::set_parallel_for_backend([](size_t count, const std::function<void(size_t)>& func) {
+            InferenceEngine::parallel_for(count, func);
+        });
+    }
+}
+
+void releaseParallelForBackend() {
+    std::lock_guard<std::mutex> lock(parallelForBackendMutex);
+    if (--parallelForBackendUsers == 0) {
+        ngraph::set_parallel_for_backend({});
+    }
+}
+
 }  // namespace
 
 DeviceIDParser::DeviceIDParser(const std::string& deviceNameWithID) {
@@ -263,7 +359,89 @@ public:
                                   const std::map<std::string, std::string>& config) override {
         OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetwork");
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
-        return GetCPPPluginByName(parsed._deviceName).LoadNetwork(network, parsed._config);
+        auto plugin = GetCPPPluginByName(parsed._deviceName);
+
+        auto cacheDir = GetCacheDir(parsed._deviceName, parsed._config);
+        auto pluginConfig = filterCacheDir(plugin, parsed._config);
+        if (!cacheDir.empty() && network.getFunction() && deviceSupportsImportExport(plugin)) {
+            return LoadNetworkCached(plugin, network, parsed._deviceName, pluginConfig, cacheDir);
+        }
+        return plugin.LoadNetwork(network, pluginConfig);
+    }
+
+    /**
+     * @brief Returns a directory of compiled networks cache for a device
+     * @param deviceName A device name
+     * @param config A config passed to LoadNetwork, it has priority over the one set via Core::SetConfig
+     * @return A path to cache directory or empty string if caching is disabled
+     */
+    std::string GetCacheDir(const std::string& deviceName, const std::map<std::string, std::string>& config) const {
+        auto it = config.find(CONFIG_KEY(CACHE_DIR));
+        if (it != config.end()) {
+            return it->second;
+        }
+
+        std::lock_guard<std::mutex> lock(pluginsMutex);
+        auto desc = pluginRegistry.find(deviceName);
+        if (desc != pluginRegistry.end()) {
+            auto cacheDir = desc->second.defaultConfig.find(CONFIG_KEY(CACHE_DIR));
+            if (cacheDir != desc->second.defaultConfig.end()) {
+                return cacheDir->second;
+            }
+        }
+        return {};
+    }
+
+    /**
+     * @brief Loads a network via a compiled networks cache: imports a compiled blob on cache hit,
+     *        compiles and exports the network to cache on cache miss
+     */
+    ExecutableNetwork LoadNetworkCached(InferencePlugin& plugin, const CNNNetwork& network,
+                                        const std::string& deviceName,
+                                        const std::map<std::string, std::string>& config,
+                                        const std::string& cacheDir) {
+        OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetworkCached");
+
+        std::string blobId;
+        try {
+            auto compileOptions = getEffectiveConfig(plugin, config);
+            compileOptions.erase(CONFIG_KEY(CACHE_DIR));
+            compileOptions["DEVICE_NAME"] = deviceName;
+            compileOptions["DEVICE_BUILD_NUMBER"] = plugin.GetVersion().buildNumber;
+            blobId = NetworkCompilationContext::computeHash(network, compileOptions);
+        } catch (const std::exception&) {
+            // e.g. networks with custom operations cannot be serialized or the plugin config cannot be
+            // represented by strings, so they bypass the cache
+            return plugin.LoadNetwork(network, config);
+        }
+
+        FileStorageCacheManager cacheManager(cacheDir);
+
+        ExecutableNetwork execNetwork;
+        bool networkIsImported = false;
+        cacheManager.readCacheEntry(blobId, [&](std::istream& networkStream) {
+            OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "Core::LoadNetworkFromCache::ReadStreamAndImport");
+            try {
+                execNetwork = plugin.ImportNetwork(networkStream, config);
+                networkIsImported = true;
+            } catch (const std::exception&) {
+                // the entry is corrupted or incompatible with the plugin, compile the network and rewrite it
+                cacheManager.removeCacheEntry(blobId);
+            }
+        });
+
+        if (!networkIsImported) {
+            execNetwork = plugin.LoadNetwork(network, config);
+            try {
+                cacheManager.writeCacheEntry(blobId, [&](std::ostream& networkStream) {
+                    execNetwork.Export(networkStream);
+                });
+            } catch (const std::exception&) {
+                // failure to cache the network is not fatal for the LoadNetwork call
+            }
+        }
+
+        return execNetwork;
     }
 
     ExecutableNetwork ImportNetwork(std::istream& networkModel, const std::string& deviceName,
@@ -379,7 +557,7 @@ public:
                 // configuring
                 {
                     allowNotImplemented([&]() {
-                        plugin.SetConfig(desc.defaultConfig);
+                        plugin.SetConfig(filterCacheDir(plugin, desc.defaultConfig));
                     });
 
                     allowNotImplemented([&]() {
@@ -486,7 +664,10 @@ public:
         for (auto& plugin : plugins) {
             if (deviceName.empty() || deviceName == plugin.first) {
                 allowNotImplemented([&]() {
-                    plugin.second.SetConfig(config);
+                    auto pluginConfig = filterCacheDir(plugin.second, config);
+                    if (!pluginConfig.empty()) {
+                        plugin.second.SetConfig(pluginConfig);
+                    }
                 });
             }
         }
@@ -529,9 +710,13 @@ Core::Impl::Impl() {
     opsetNames.insert("opset2");
     opsetNames.insert("opset3");
     opsetNames.insert("opset4");
+
+    acquireParallelForBackend();
 }
 
-Core::Impl::~Impl() {}
+Core::Impl::~Impl() {
+    releaseParallelForBackend();
+}
 
 Core::Core(const std::string& xmlConfigFile) {
     _impl = std::make_shared<Impl>();
@@ -564,6 +749,14 @@ std::map<std::string, Version> Core::GetVersions(const std::string& deviceName)
                 deviceNames = DeviceIDParser::getMultiDevices(deviceName.substr(pos + 1));
             }
             deviceNames.push_back("MULTI");
+        } else if (deviceName.find("BATCH") == 0) {
+            auto pos = deviceName.find_first_of(":");
+            if (pos != std::string::npos) {
+                // the batch size in brackets is not a part of the device name
+                auto device = deviceName.substr(pos + 1);
+                deviceNames.push_back(device.substr(0, device.find_first_of('(')));
+            }
+            deviceNames.push_back("BATCH");
         } else {
             deviceNames.push_back(deviceName);
         }
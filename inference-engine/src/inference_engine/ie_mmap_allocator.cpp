@@ -0,0 +1,107 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_mmap_allocator.hpp"
+
+#ifdef _WIN32
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <windows.h>
+# include <file_utils.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace InferenceEngine {
+
+MmapAllocator::MmapAllocator(const std::string& path) : _path(path) {}
+
+#ifdef _WIN32
+
+void* MmapAllocator::alloc(size_t size) noexcept {
+    if (size == 0 || _size != 0) {
+        return nullptr;
+    }
+    try {
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+        HANDLE file = CreateFileW(FileUtils::multiByteCharToWString(_path.c_str()).c_str(),
+#else
+        HANDLE file = CreateFileA(_path.c_str(),
+#endif
+                                  GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return nullptr;
+        }
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || static_cast<unsigned long long>(fileSize.QuadPart) < size) {
+            CloseHandle(file);
+            return nullptr;
+        }
+        HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        // the view keeps both the mapping and the file alive
+        CloseHandle(file);
+        if (mapping == nullptr) {
+            return nullptr;
+        }
+        void* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, size);
+        CloseHandle(mapping);
+        if (data == nullptr) {
+            return nullptr;
+        }
+        _size = size;
+        return data;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+bool MmapAllocator::free(void* handle) noexcept {
+    if (handle == nullptr || _size == 0) {
+        return false;
+    }
+    _size = 0;
+    return UnmapViewOfFile(handle) != 0;
+}
+
+#else
+
+void* MmapAllocator::alloc(size_t size) noexcept {
+    if (size == 0 || _size != 0) {
+        return nullptr;
+    }
+    int fd = open(_path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        return nullptr;
+    }
+    struct stat sb = {};
+    if (fstat(fd, &sb) == -1 || static_cast<size_t>(sb.st_size) < size) {
+        close(fd);
+        return nullptr;
+    }
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    // the mapping stays valid after the descriptor is closed
+    close(fd);
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+    _size = size;
+    return data;
+}
+
+bool MmapAllocator::free(void* handle) noexcept {
+    if (handle == nullptr || _size == 0) {
+        return false;
+    }
+    bool unmapped = munmap(handle, _size) == 0;
+    _size = 0;
+    return unmapped;
+}
+
+#endif
+
+}  // namespace InferenceEngine
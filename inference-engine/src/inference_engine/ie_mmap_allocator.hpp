@@ -0,0 +1,53 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the allocator which maps a file into memory
+ *
+ * @file ie_mmap_allocator.hpp
+ */
+#pragma once
+
+#include <string>
+
+#include "ie_allocator.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Allocator which provides a read-only file content as a memory block
+ *
+ * The file is mapped copy-on-write, so the pages are shared with the OS page cache
+ * and loaded lazily, while writes to the blob never reach the file.
+ * A single allocator instance serves a single mapping.
+ */
+class MmapAllocator : public IAllocator {
+public:
+    /**
+     * @brief Constructor
+     * @param path Path to the file to map
+     */
+    explicit MmapAllocator(const std::string& path);
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    /**
+     * @brief Maps first `size` bytes of the file
+     * @param size Number of bytes to map, must not exceed the file size
+     * @return Pointer to the mapped memory or `nullptr` if the file cannot be mapped
+     */
+    void* alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+private:
+    std::string _path;
+    size_t _size = 0;
+};
+
+}  // namespace InferenceEngine
@@ -4,6 +4,7 @@
 
 #include "ie_network_reader.hpp"
 #include "ie_itt.hpp"
+#include "ie_mmap_allocator.hpp"
 
 #include <details/ie_so_pointer.hpp>
 #include <file_utils.h>
@@ -121,6 +122,11 @@ void registerReaders() {
     if (irReaderv10)
         readers.emplace("xml", irReaderv10);
 
+    // try to load binary IR reader if library exists
+    auto irBinaryReader = create_if_exists("IRBinary", std::string("inference_engine_ir_binary_reader") + std::string(IE_BUILD_POSTFIX));
+    if (irBinaryReader)
+        readers.emplace("irb", irBinaryReader);
+
     // try to load IR reader v7 if library exists
     auto irReaderv7 = create_if_exists("IRv7", std::string("inference_engine_ir_v7_reader") + std::string(IE_BUILD_POSTFIX));
     if (irReaderv7)
@@ -148,6 +154,22 @@ void assertIfIRv7LikeModel(std::istream & modelStream) {
         "version of the OpenVINO to generate supported IR version.";
 }
 
+/**
+ * @brief Maps weights file into memory
+ * @param path Path to the weights file
+ * @return Blob over the mapped file or nullptr if the file cannot be mapped
+ */
+Blob::Ptr mapWeights(const std::string& path) {
+    auto fileSize = FileUtils::fileSize(path);
+    if (fileSize <= 0)
+        return nullptr;
+    auto weights = make_shared_blob<uint8_t>({Precision::U8, { static_cast<size_t>(fileSize) }, C }, std::make_shared<MmapAllocator>(path));
+    weights->allocate();
+    if (weights->buffer() == nullptr)
+        return nullptr;
+    return weights;
+}
+
 }  // namespace
 
 CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts) {
@@ -194,27 +216,31 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
                 }
             }
             if (!bPath.empty()) {
-                // Open weights file
+                // Map weights file, the reader creates constants on top of the blob without copying
+                Blob::Ptr weights = mapWeights(bPath);
+                if (!weights) {
+                    // Open weights file
 #if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-                std::wstring weights_path = FileUtils::multiByteCharToWString(bPath.c_str());
+                    std::wstring weights_path = FileUtils::multiByteCharToWString(bPath.c_str());
 #else
-                std::string weights_path = bPath;
+                    std::string weights_path = bPath;
 #endif
-                std::ifstream binStream;
-                binStream.open(weights_path, std::ios::binary);
-                if (!binStream.is_open())
-                    THROW_IE_EXCEPTION << "Weights file " << bPath << " cannot be opened!";
+                    std::ifstream binStream;
+                    binStream.open(weights_path, std::ios::binary);
+                    if (!binStream.is_open())
+                        THROW_IE_EXCEPTION << "Weights file " << bPath << " cannot be opened!";
 
-                binStream.seekg(0, std::ios::end);
-                size_t fileSize = binStream.tellg();
-                binStream.seekg(0, std::ios::beg);
+                    binStream.seekg(0, std::ios::end);
+                    size_t fileSize = binStream.tellg();
+                    binStream.seekg(0, std::ios::beg);
 
-                Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
-                weights->allocate();
+                    weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
+                    weights->allocate();
 
-                binStream.read(weights->buffer(), fileSize);
+                    binStream.read(weights->buffer(), fileSize);
 
-                binStream.close();
+                    binStream.close();
+                }
 
                 // read model with weights
                 auto network = reader->read(modelStream, weights, exts);
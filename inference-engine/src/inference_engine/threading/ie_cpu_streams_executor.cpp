@@ -10,9 +10,11 @@
 #include <thread>
 #include <queue>
 #include <atomic>
+#include <cstdint>
 #include <climits>
 #include <cassert>
 #include <utility>
+#include <algorithm>
 
 #include "threading/ie_thread_local.hpp"
 #include "ie_parallel.hpp"
@@ -25,6 +27,12 @@
 using namespace openvino;
 
 namespace InferenceEngine {
+namespace {
+// a worker thread sets these before its stream is created, so the stream gets the index of the worker's task queue
+thread_local const void*    thisWorkerExecutor = nullptr;
+thread_local int            thisWorkerStreamId = 0;
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -57,7 +65,10 @@ struct CPUStreamsExecutor::Impl {
 #endif
         explicit Stream(Impl* impl) :
             _impl(impl) {
-            {
+            if (thisWorkerExecutor == _impl) {
+                _streamId = thisWorkerStreamId;
+                _isWorker = true;
+            } else {
                 std::lock_guard<std::mutex> lock{_impl->_streamIdMutex};
                 if (_impl->_streamIdQueue.empty()) {
                     _streamId = _impl->_streamId++;
@@ -66,11 +77,7 @@ struct CPUStreamsExecutor::Impl {
                     _impl->_streamIdQueue.pop();
                 }
             }
-            _numaNodeId = _impl->_config._streams
-                ? _impl->_usedNumaNodes.at(
-                    (_streamId % _impl->_config._streams)/
-                    ((_impl->_config._streams + _impl->_usedNumaNodes.size() - 1)/_impl->_usedNumaNodes.size()))
-                : _impl->_usedNumaNodes.at(_streamId % _impl->_usedNumaNodes.size());
+            _numaNodeId = _impl->_usedNumaNodes.at(_impl->NumaNodeIndex(_streamId));
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
             auto concurrency = (0 == _impl->_config._threadsPerStream) ? tbb::task_arena::automatic : _impl->_config._threadsPerStream;
             if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
@@ -124,7 +131,7 @@ struct CPUStreamsExecutor::Impl {
 #endif
         }
         ~Stream() {
-            {
+            if (!_isWorker) {
                 std::lock_guard<std::mutex> lock{_impl->_streamIdMutex};
                 _impl->_streamIdQueue.push(_streamId);
             }
@@ -138,6 +145,7 @@ struct CPUStreamsExecutor::Impl {
         Impl* _impl     = nullptr;
         int _streamId   = 0;
         int _numaNodeId = 0;
+        bool _isWorker = false;
         bool _execute = false;
         std::queue<Task> _taskQueue;
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -146,8 +154,121 @@ struct CPUStreamsExecutor::Impl {
 #endif
     };
 
+    /**
+     * @brief Bounded lock-free queue that can be pushed to and popped from by any thread.
+     *        Each cell carries a sequence number telling whether it is ready to be written or read
+     *        on the current lap over the ring.
+     */
+    class TaskQueue {
+    public:
+        explicit TaskQueue(std::size_t capacity) :
+            _cells{new Cell[capacity]},
+            _mask{capacity - 1} {
+            assert(capacity >= 2 && 0 == (capacity & _mask));
+            for (std::size_t i = 0; i < capacity; ++i) {
+                _cells[i]._sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        bool TryPush(Task& task) {
+            auto pos = _pushPos.load(std::memory_order_relaxed);
+            for (;;) {
+                auto& cell = _cells[pos & _mask];
+                auto diff = static_cast<std::intptr_t>(cell._sequence.load(std::memory_order_acquire)) -
+                            static_cast<std::intptr_t>(pos);
+                if (0 == diff) {
+                    if (_pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        cell._task = std::move(task);
+                        cell._sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = _pushPos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool TryPop(Task& task) {
+            auto pos = _popPos.load(std::memory_order_relaxed);
+            for (;;) {
+                auto& cell = _cells[pos & _mask];
+                auto diff = static_cast<std::intptr_t>(cell._sequence.load(std::memory_order_acquire)) -
+                            static_cast<std::intptr_t>(pos + 1);
+                if (0 == diff) {
+                    if (_popPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        task = std::move(cell._task);
+                        cell._task = nullptr;
+                        cell._sequence.store(pos + _mask + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = _popPos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+    private:
+        static constexpr std::size_t cacheLineSize = 64;
+        struct Cell {
+            std::atomic<std::size_t>    _sequence;
+            Task                        _task;
+        };
+        std::unique_ptr<Cell[]>     _cells;
+        const std::size_t           _mask;
+        char                        _pad0[cacheLineSize];
+        std::atomic<std::size_t>    _pushPos{0};
+        char                        _pad1[cacheLineSize - sizeof(std::atomic<std::size_t>)];
+        std::atomic<std::size_t>    _popPos{0};
+        char                        _pad2[cacheLineSize - sizeof(std::atomic<std::size_t>)];
+    };
+
+    static constexpr std::size_t taskQueueCapacity = 256;
+
+    /**
+     * @brief Queue of the tasks bound to a NUMA node. Tasks which do not fit the ring wait in the overflow list,
+     *        so they are never taken by streams of other nodes
+     */
+    struct NumaNodeQueue {
+        NumaNodeQueue() : _ring{taskQueueCapacity} {}
+
+        void Push(Task& task) {
+            if (!_ring.TryPush(task)) {
+                std::lock_guard<std::mutex> lock(_overflowMutex);
+                _overflowQueue.emplace(std::move(task));
+                ++_overflowSize;
+            }
+        }
+
+        bool TryPop(Task& task) {
+            if (_ring.TryPop(task)) {
+                return true;
+            }
+            if (_overflowSize.load() > 0) {
+                std::lock_guard<std::mutex> lock(_overflowMutex);
+                if (!_overflowQueue.empty()) {
+                    task = std::move(_overflowQueue.front());
+                    _overflowQueue.pop();
+                    --_overflowSize;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        TaskQueue                   _ring;
+        std::mutex                  _overflowMutex;
+        std::queue<Task>            _overflowQueue;
+        std::atomic<std::size_t>    _overflowSize{0};
+    };
+
     explicit Impl(const Config& config) :
         _config{config},
+        // ids of the worker streams match their task queues, streams of external threads get the following ids
+        _streamId{config._streams},
         _streams([this] {
             return std::make_shared<Impl::Stream>(this);
         }) {
@@ -159,33 +280,147 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = numaNodes;
         }
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _taskQueues.emplace_back(new TaskQueue{taskQueueCapacity});
+        }
+        for (std::size_t i = 0; i < _usedNumaNodes.size() && _config._streams != 0; ++i) {
+            _numaNodeQueues.emplace_back(new NumaNodeQueue);
+        }
+        // the streams are split into blocks per node, so the last nodes may get no streams at all
+        _numaNodeStreams.resize(_usedNumaNodes.size(), 0);
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            ++_numaNodeStreams[NumaNodeIndex(streamId)];
+        }
+        // a stream steals from the streams of its own NUMA node first
+        _stealOrder.resize(_config._streams);
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            for (int i = 1; i < _config._streams; ++i) {
+                _stealOrder[streamId].push_back((streamId + i) % _config._streams);
+            }
+            std::stable_partition(_stealOrder[streamId].begin(), _stealOrder[streamId].end(), [&] (int victim) {
+                return NumaNodeIndex(victim) == NumaNodeIndex(streamId);
+            });
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
-                    Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
-                    }
+                thisWorkerExecutor = this;
+                thisWorkerStreamId = streamId;
+                // the stream is created eagerly, so the thread is bound before it allocates anything
+                auto& stream = *(_streams.local());
+                for (Task task; Pull(streamId, task); task = nullptr) {
+                    Execute(task, stream);
                 }
             });
         }
     }
 
-    void Enqueue(Task task) {
-        {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+    /**
+     * @brief Returns the index in _usedNumaNodes of the NUMA node the stream belongs to
+     */
+    std::size_t NumaNodeIndex(int streamId) const {
+        return _config._streams
+            ? (streamId % _config._streams)/((_config._streams + _usedNumaNodes.size() - 1)/_usedNumaNodes.size())
+            : streamId % _usedNumaNodes.size();
+    }
+
+    /**
+     * @brief Queues the task to the stream queues round-robin, or to the queue of the NUMA node
+     *        which is pulled only by the streams of the node
+     */
+    void Enqueue(Task task, int numaNodeId = -1) {
+        bool pushed = false;
+        bool toNumaNode = false;
+        if (numaNodeId >= 0) {
+            auto itNumaNode = std::find(_usedNumaNodes.begin(), _usedNumaNodes.end(), numaNodeId);
+            const auto numaNodeIndex = std::distance(_usedNumaNodes.begin(), itNumaNode);
+            if (itNumaNode != _usedNumaNodes.end() && _numaNodeStreams[numaNodeIndex] > 0) {
+                _numaNodeQueues[numaNodeIndex]->Push(task);
+                pushed = toNumaNode = true;
+            }
+        }
+        if (!pushed) {
+            const auto streamId = _nextQueue++ % _taskQueues.size();
+            for (std::size_t i = 0; i < _taskQueues.size() && !pushed; ++i) {
+                pushed = _taskQueues[(streamId + i) % _taskQueues.size()]->TryPush(task);
+            }
+        }
+        if (!pushed) {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
+            _overflowQueue.emplace(std::move(task));
+            ++_overflowSize;
+        }
+        ++_enqueued;
+        auto queued = ++_queued;
+        for (auto maxQueued = _maxQueued.load(std::memory_order_relaxed);
+             queued > maxQueued && !_maxQueued.compare_exchange_weak(maxQueued, queued, std::memory_order_relaxed);) {}
+
+        // pairs with the fence in Pull(): either a parking thread sees the task or the task sees the parking thread
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_parkedThreads.load(std::memory_order_relaxed) > 0) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+            }
+            // a single woken thread may belong to other NUMA node and be unable to take the task
+            if (toNumaNode) {
+                _queueCondVar.notify_all();
+            } else {
+                _queueCondVar.notify_one();
+            }
+        }
+    }
+
+    bool TryPull(int streamId, Task& task) {
+        if (_taskQueues[streamId]->TryPop(task) || _numaNodeQueues[NumaNodeIndex(streamId)]->TryPop(task)) {
+            --_queued;
+            return true;
+        }
+        for (auto victim : _stealOrder[streamId]) {
+            if (_taskQueues[victim]->TryPop(task)) {
+                --_queued;
+                ++_stolen;
+                return true;
+            }
+        }
+        if (_overflowSize.load() > 0) {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
+            if (!_overflowQueue.empty()) {
+                task = std::move(_overflowQueue.front());
+                _overflowQueue.pop();
+                --_overflowSize;
+                --_queued;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Takes a task from the own queue, steals it from other streams or parks the thread until a task arrives
+     * @return false if the executor is stopped and all the tasks are done
+     */
+    bool Pull(int streamId, Task& task) {
+        for (int spin = 0; spin < _config._spinCount; ++spin) {
+            if (TryPull(streamId, task)) {
+                return true;
+            }
+            std::this_thread::yield();
+        }
+        std::unique_lock<std::mutex> lock(_mutex);
+        ++_parkedThreads;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (;;) {
+            if (TryPull(streamId, task)) {
+                --_parkedThreads;
+                return true;
+            }
+            if (_isStopped) {
+                --_parkedThreads;
+                return false;
+            }
+            ++_parks;
+            _queueCondVar.wait(lock);
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -221,10 +456,23 @@ struct CPUStreamsExecutor::Impl {
     int                                     _streamId = 0;
     std::queue<int>                         _streamIdQueue;
     std::vector<std::thread>                _threads;
+    std::vector<std::unique_ptr<TaskQueue>> _taskQueues;
+    std::vector<std::unique_ptr<NumaNodeQueue>> _numaNodeQueues;
+    std::vector<int>                        _numaNodeStreams;
+    std::vector<std::vector<int>>           _stealOrder;
+    std::atomic<std::size_t>                _nextQueue{0};
+    std::mutex                              _overflowMutex;
+    std::queue<Task>                        _overflowQueue;
+    std::atomic<std::size_t>                _overflowSize{0};
     std::mutex                              _mutex;
     std::condition_variable                 _queueCondVar;
-    std::queue<Task>                        _taskQueue;
+    std::atomic<int>                        _parkedThreads{0};
     bool                                    _isStopped = false;
+    std::atomic<std::size_t>                _queued{0};
+    std::atomic<std::size_t>                _maxQueued{0};
+    std::atomic<std::size_t>                _enqueued{0};
+    std::atomic<std::size_t>                _stolen{0};
+    std::atomic<std::size_t>                _parks{0};
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
 };
@@ -240,6 +488,16 @@ int CPUStreamsExecutor::GetNumaNodeId() {
     return stream->_numaNodeId;
 }
 
+CPUStreamsExecutor::Counters CPUStreamsExecutor::GetCounters() const {
+    Counters counters;
+    counters.queued = _impl->_queued.load();
+    counters.maxQueued = _impl->_maxQueued.load();
+    counters.enqueued = _impl->_enqueued.load();
+    counters.stolen = _impl->_stolen.load();
+    counters.parks = _impl->_parks.load();
+    return counters;
+}
+
 CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) :
     _impl{new Impl{config}} {
 }
@@ -261,6 +519,14 @@ void CPUStreamsExecutor::Execute(Task task) {
     _impl->Defer(std::move(task));
 }
 
+void CPUStreamsExecutor::RunOnNumaNode(int numaNodeId, Task task) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), numaNodeId);
+    }
+}
+
 void CPUStreamsExecutor::run(Task task) {
     if (0 == _impl->_config._streams) {
         _impl->Defer(std::move(task));
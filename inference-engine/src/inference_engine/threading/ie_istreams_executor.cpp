@@ -13,17 +13,23 @@
 #include <algorithm>
 #include <vector>
 #include <thread>
+#include <utility>
 
 
 namespace InferenceEngine {
 IStreamsExecutor::~IStreamsExecutor() {}
 
+void IStreamsExecutor::RunOnNumaNode(int, Task task) {
+    run(std::move(task));
+}
+
 std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() {
     return {
         CONFIG_KEY(CPU_THROUGHPUT_STREAMS),
         CONFIG_KEY(CPU_BIND_THREAD),
         CONFIG_KEY(CPU_THREADS_NUM),
         CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM),
+        CONFIG_KEY_INTERNAL(CPU_STREAM_SPIN_COUNT),
     };
 }
 
@@ -106,6 +112,19 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                                    << ". Expected only non negative numbers (#threads)";
             }
             _threadsPerStream = val_i;
+        } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAM_SPIN_COUNT)) {
+            int val_i;
+            try {
+                val_i = std::stoi(value);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_STREAM_SPIN_COUNT)
+                                   << ". Expected only non negative numbers (#attempts)";
+            }
+            if (val_i < 0) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_STREAM_SPIN_COUNT)
+                                   << ". Expected only non negative numbers (#attempts)";
+            }
+            _spinCount = val_i;
         } else {
             THROW_IE_EXCEPTION << "Wrong value for property key " << key;
         }
@@ -130,6 +149,8 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) {
         return {_threads};
     } else if (key == CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM)) {
         return {_threadsPerStream};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAM_SPIN_COUNT)) {
+        return {_spinCount};
     } else {
         THROW_IE_EXCEPTION << "Wrong value for property key " << key;
     }
@@ -81,4 +81,15 @@ using printer_callback =
 INFERENCE_ENGINE_API_CPP(void)
 saveGraphToDot(const InferenceEngine::CNNNetwork& network, std::ostream& out, printer_callback layer_cb = nullptr);
 
+/**
+ * @brief Serializes network to the legacy IR which is read back by the IR v7 reader
+ * @note Bodies of TensorIterator layers are not serialized
+ *
+ * @param network - network to serialize
+ * @param xml - output stream for the IR XML
+ * @param weights - output stream for blobs of layers
+ */
+INFERENCE_ENGINE_API_CPP(void)
+serializeLegacyNetwork(const InferenceEngine::CNNNetwork& network, std::ostream& xml, std::ostream& weights);
+
 }  // namespace InferenceEngine
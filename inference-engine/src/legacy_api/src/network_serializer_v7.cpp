@@ -417,6 +417,16 @@ void SerializeBlobs(std::ostream& stream, const InferenceEngine::CNNNetwork& net
 
 }  // namespace
 
+void Serialize(std::ostream& xmlStream, std::ostream& binStream, const InferenceEngine::CNNNetwork& network) {
+    pugi::xml_document doc;
+    FillXmlDoc(network, doc, false, true);
+    doc.save(xmlStream);
+    if (!xmlStream.good()) {
+        THROW_IE_EXCEPTION << "Error during writing IR xml";
+    }
+    SerializeBlobs(binStream, network);
+}
+
 void Serialize(const std::string& xmlPath, const std::string& binPath,
                const InferenceEngine::CNNNetwork& network) {
     // A flag for serializing executable graph information (not complete IR)
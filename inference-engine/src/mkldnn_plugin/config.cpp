@@ -59,6 +59,18 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // zero and any negative value will be treated
             // as default batch size
             batchLimit = std::max(val_i, 0);
+        } else if (key == PluginConfigParams::KEY_CPU_SHAPE_CACHE_CAPACITY) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHAPE_CACHE_CAPACITY
+                                    << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHAPE_CACHE_CAPACITY
+                                    << ". Expected only non-negative integer numbers";
+            shapeCacheCapacity = val_i;
         } else if (key == PluginConfigParams::KEY_PERF_COUNT) {
             if (val == PluginConfigParams::YES) collectPerfCounters = true;
             else if (val == PluginConfigParams::NO) collectPerfCounters = false;
@@ -79,6 +91,33 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_DYN_BATCH_ENABLED
                 << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL) {
+            if (val == PluginConfigParams::YES) interOpParallel = true;
+            else if (val == PluginConfigParams::NO) interOpParallel = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_SNIPPETS) {
+            if (val == PluginConfigParams::YES) enableSnippets = true;
+            else if (val == PluginConfigParams::NO) enableSnippets = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SNIPPETS
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_NUMA_PLACEMENT) {
+            if (val == PluginConfigParams::YES) numaPlacement = true;
+            else if (val == PluginConfigParams::NO) numaPlacement = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_NUMA_PLACEMENT
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_MEMORY_SOLVER) {
+            if (val == PluginConfigParams::CPU_MEMORY_SOLVER_GREEDY)
+                memorySolverStrategy = MemorySolver::Strategy::Greedy;
+            else if (val == PluginConfigParams::CPU_MEMORY_SOLVER_BEST_FIT)
+                memorySolverStrategy = MemorySolver::Strategy::BestFit;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_MEMORY_SOLVER
+                                   << ". Expected only " << PluginConfigParams::CPU_MEMORY_SOLVER_GREEDY
+                                   << "/" << PluginConfigParams::CPU_MEMORY_SOLVER_BEST_FIT;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT) == 0) {
             // empty string means that dumping is switched off
             dumpToDot = val;
@@ -141,7 +180,24 @@ void Config::updateProperties() {
         else
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
 
+        if (interOpParallel == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL, PluginConfigParams::NO });
+        if (enableSnippets == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_SNIPPETS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_SNIPPETS, PluginConfigParams::NO });
+        if (numaPlacement == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_NUMA_PLACEMENT, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_NUMA_PLACEMENT, PluginConfigParams::NO });
+        if (memorySolverStrategy == MemorySolver::Strategy::Greedy)
+            _config.insert({ PluginConfigParams::KEY_CPU_MEMORY_SOLVER, PluginConfigParams::CPU_MEMORY_SOLVER_GREEDY });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_MEMORY_SOLVER, PluginConfigParams::CPU_MEMORY_SOLVER_BEST_FIT });
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHAPE_CACHE_CAPACITY, std::to_string(shapeCacheCapacity) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
@@ -7,6 +7,7 @@
 #include <string>
 #include <map>
 #include <threading/ie_istreams_executor.hpp>
+#include "mkldnn_memory_solver.hpp"
 
 namespace MKLDNNPlugin {
 
@@ -21,10 +22,15 @@ struct Config {
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool interOpParallel = false;
+    bool enableSnippets = false;
+    bool numaPlacement = false;
+    MemorySolver::Strategy memorySolverStrategy = MemorySolver::Strategy::Greedy;
     std::string dumpToDot = "";
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
     int batchLimit = 0;
+    int shapeCacheCapacity = 0;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
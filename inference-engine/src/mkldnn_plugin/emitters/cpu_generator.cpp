@@ -0,0 +1,217 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_generator.hpp"
+
+#include <set>
+#include <vector>
+
+#include <ngraph/pass/manager.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <snippets/snippets_isa.hpp>
+#include <snippets/pass/assign_registers.hpp>
+#include <snippets/pass/vector_to_scalar.hpp>
+
+#include "jit_eltwise_emitters.hpp"
+#include "jit_mkldnn_emitters.hpp"
+#include "jit_snippets_emitters.hpp"
+
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+using EmitterFactory = std::function<std::shared_ptr<ngraph::snippets::Emitter>(std::shared_ptr<ngraph::Node>)>;
+
+template <typename T>
+EmitterFactory createEmitter(jit_generator* h, cpu_isa_t isa) {
+    return [h, isa](std::shared_ptr<ngraph::Node> n) -> std::shared_ptr<ngraph::snippets::Emitter> {
+        return std::make_shared<T>(h, isa, n);
+    };
+}
+
+}  // namespace
+
+CPUTargetMachine::CPUTargetMachine(jit_generator* h, cpu_isa_t isa) : h(h), isa(isa) {}
+
+auto CPUTargetMachine::getJitters() -> std::map<const ngraph::DiscreteTypeInfo, EmitterFactory> {
+    return {
+        // snippets dialect
+        { ngraph::snippets::op::Load::type_info, createEmitter<jit_snippets_load_emitter>(h, isa) },
+        { ngraph::snippets::op::ScalarLoad::type_info, createEmitter<jit_snippets_scalar_load_emitter>(h, isa) },
+        { ngraph::snippets::op::BroadcastLoad::type_info, createEmitter<jit_snippets_broadcast_load_emitter>(h, isa) },
+        { ngraph::snippets::op::Store::type_info, createEmitter<jit_snippets_store_emitter>(h, isa) },
+        { ngraph::snippets::op::ScalarStore::type_info, createEmitter<jit_snippets_scalar_store_emitter>(h, isa) },
+        { ngraph::snippets::op::BroadcastMove::type_info, createEmitter<jit_snippets_broadcast_move_emitter>(h, isa) },
+        { ngraph::snippets::op::Scalar::type_info, createEmitter<jit_snippets_scalar_emitter>(h, isa) },
+        { ngraph::snippets::op::PowerStatic::type_info, createEmitter<jit_power_static_emitter>(h, isa) },
+
+        // binary
+        { ngraph::opset1::Add::type_info, createEmitter<jit_add_emitter>(h, isa) },
+        { ngraph::opset1::Subtract::type_info, createEmitter<jit_subtract_emitter>(h, isa) },
+        { ngraph::opset1::Multiply::type_info, createEmitter<jit_multiply_emitter>(h, isa) },
+        { ngraph::opset1::Divide::type_info, createEmitter<jit_divide_emitter>(h, isa) },
+        { ngraph::opset1::Maximum::type_info, createEmitter<jit_maximum_emitter>(h, isa) },
+        { ngraph::opset1::Minimum::type_info, createEmitter<jit_minimum_emitter>(h, isa) },
+        { ngraph::opset1::Mod::type_info, createEmitter<jit_mod_emitter>(h, isa) },
+        { ngraph::opset1::FloorMod::type_info, createEmitter<jit_floor_mod_emitter>(h, isa) },
+        { ngraph::opset1::SquaredDifference::type_info, createEmitter<jit_squared_difference_emitter>(h, isa) },
+        { ngraph::opset1::Power::type_info, createEmitter<jit_power_dynamic_emitter>(h, isa) },
+        { ngraph::opset1::PRelu::type_info, createEmitter<jit_prelu_emitter>(h, isa) },
+
+        // unary
+        { ngraph::opset1::Negative::type_info, createEmitter<jit_negative_emitter>(h, isa) },
+        { ngraph::opset1::Sqrt::type_info, createEmitter<jit_sqrt_emitter>(h, isa) },
+        { ngraph::opset1::Relu::type_info, createEmitter<jit_relu_emitter>(h, isa) },
+        { ngraph::opset1::Sigmoid::type_info, createEmitter<jit_sigmoid_emitter>(h, isa) },
+        { ngraph::opset1::Tanh::type_info, createEmitter<jit_tanh_emitter>(h, isa) },
+        { ngraph::opset1::Elu::type_info, createEmitter<jit_elu_emitter>(h, isa) },
+        { ngraph::opset1::Exp::type_info, createEmitter<jit_exp_emitter>(h, isa) },
+        { ngraph::opset1::Abs::type_info, createEmitter<jit_abs_emitter>(h, isa) },
+        { ngraph::opset1::Clamp::type_info, createEmitter<jit_clamp_emitter>(h, isa) },
+    };
+}
+
+class CPUGenerator::jit_snippet : public jit_generator {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_snippet)
+
+    struct Statement {
+        std::shared_ptr<ngraph::snippets::Emitter> emitter;
+        ngraph::snippets::RegInfo regs;
+    };
+
+    explicit jit_snippet(cpu_isa_t isa) : jit_generator(), isa(isa) {}
+
+    const uint8_t* create() {
+        jit_generator::create_kernel();
+        return jit_ker();
+    }
+
+    size_t numArgs = 0;
+    int vectorLength = 0;
+    std::vector<Statement> vectorBody;
+    std::vector<Statement> scalarBody;
+
+private:
+    void generate() override {
+        preamble();
+
+        for (size_t i = 0; i < numArgs; i++)
+            mov(Reg64(firstArgIdx + i), ptr[reg_params + offsetof(jit_snippets_call_args, ptrs) + i * sizeof(void*)]);
+        mov(reg_work_amount, ptr[reg_params + offsetof(jit_snippets_call_args, work_amount)]);
+
+        Label vector_loop_label;
+        Label tail_loop_label;
+        Label exit_label;
+
+        L(vector_loop_label);
+        {
+            cmp(reg_work_amount, vectorLength);
+            jl(tail_loop_label, T_NEAR);
+
+            emitBody(vectorBody);
+
+            sub(reg_work_amount, vectorLength);
+            jmp(vector_loop_label, T_NEAR);
+        }
+
+        L(tail_loop_label);
+        {
+            cmp(reg_work_amount, 1);
+            jl(exit_label, T_NEAR);
+
+            emitBody(scalarBody);
+
+            sub(reg_work_amount, 1);
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+        postamble();
+
+        for (const auto& stmt : vectorBody)
+            stmt.emitter->emit_data();
+        for (const auto& stmt : scalarBody)
+            stmt.emitter->emit_data();
+    }
+
+    void emitBody(const std::vector<Statement>& body) {
+        // vector registers not allocated to any tensor of the body are given to emitters as auxiliary ones,
+        // the rest of auxiliary registers are preserved on the stack by emitters themselves
+        std::set<size_t> used;
+        for (const auto& stmt : body) {
+            used.insert(stmt.regs.first.begin(), stmt.regs.first.end());
+            used.insert(stmt.regs.second.begin(), stmt.regs.second.end());
+        }
+        const size_t maxVecs = isa == avx512_common ? 32 : 16;
+        std::vector<size_t> pool;
+        for (size_t idx = 0; idx < maxVecs; idx++) {
+            if (used.count(idx) == 0)
+                pool.push_back(idx);
+        }
+
+        for (const auto& stmt : body)
+            stmt.emitter->emit_code(stmt.regs.first, stmt.regs.second, pool, {});
+    }
+
+    // snippets::pass::AssignRegisters places parameters and then results starting from R8
+    static constexpr int firstArgIdx = 8;
+
+    cpu_isa_t isa;
+    Reg64 reg_params = abi_param1;
+    Reg64 reg_work_amount = rdx;
+};
+
+CPUGenerator::CPUGenerator(cpu_isa_t isa) : h(new jit_snippet(isa)), isa(isa) {
+    jitters = CPUTargetMachine(h.get(), isa).getJitters();
+}
+
+CPUGenerator::~CPUGenerator() = default;
+
+size_t CPUGenerator::getVectorLength() const {
+    return isa == avx512_common ? 16 : isa == avx2 ? 8 : 4;
+}
+
+ngraph::snippets::code CPUGenerator::generate(std::shared_ptr<ngraph::Function>& f) const {
+    const size_t numArgs = f->get_parameters().size() + f->get_results().size();
+    if (numArgs > jit_snippets_call_args::maxArgs)
+        THROW_IE_EXCEPTION << "Snippet has " << numArgs << " inputs and outputs while at most "
+                           << jit_snippets_call_args::maxArgs << " are supported";
+
+    // the tail is processed element by element with the same body where loads and stores are scalar
+    auto scalarFunction = ngraph::clone_function(*f);
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::snippets::pass::ReplaceLoadsWithScalarLoads>();
+    manager.register_pass<ngraph::snippets::pass::ReplaceStoresWithScalarStores>();
+    manager.run_passes(scalarFunction);
+    ngraph::snippets::pass::AssignRegisters().run_on_function(scalarFunction);
+
+    auto lower = [this](const std::shared_ptr<ngraph::Function>& body) {
+        std::vector<jit_snippet::Statement> statements;
+        for (auto op : body->get_ordered_ops()) {
+            if (ngraph::is_type<ngraph::opset1::Parameter>(op) || ngraph::is_type<ngraph::opset1::Result>(op))
+                continue;
+
+            auto jitter = jitters.find(op->get_type_info());
+            if (jitter == jitters.end())
+                THROW_IE_EXCEPTION << "Snippets code generator doesn't support " << op->get_type_name() << " operation";
+
+            statements.push_back({jitter->second(op), ngraph::snippets::getRegisters(op)});
+        }
+        return statements;
+    };
+
+    h->numArgs = numArgs;
+    h->vectorLength = static_cast<int>(getVectorLength());
+    h->vectorBody = lower(f);
+    h->scalarBody = lower(scalarFunction);
+
+    return h->create();
+}
+
+} // namespace MKLDNNPlugin
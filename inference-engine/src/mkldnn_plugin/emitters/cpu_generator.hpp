@@ -0,0 +1,65 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+
+#include <cpu/x64/jit_generator.hpp>
+#include <snippets/generator.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Arguments of a kernel generated by CPUGenerator.
+ * ptrs contains pointers to the current row of every snippet parameter followed by every snippet result,
+ * the kernel processes work_amount elements of the row.
+ */
+struct jit_snippets_call_args {
+    static constexpr size_t maxArgs = 8;
+
+    const void* ptrs[maxArgs];
+    size_t work_amount;
+};
+
+/**
+ * @brief x64 target machine for snippets: maps snippets dialect and elementwise operations to jit emitters
+ */
+class CPUTargetMachine : public ngraph::snippets::TargetMachine {
+public:
+    CPUTargetMachine(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa);
+
+    auto getJitters() -> std::map<const ngraph::DiscreteTypeInfo,
+                                  std::function<std::shared_ptr<ngraph::snippets::Emitter>(std::shared_ptr<ngraph::Node>)>> override;
+
+private:
+    mkldnn::impl::cpu::x64::jit_generator* h;
+    mkldnn::impl::cpu::x64::cpu_isa_t isa;
+};
+
+/**
+ * @brief Generates a single kernel for a snippet body in canonical form.
+ * The kernel processes a row with a vector loop followed by a scalar loop for the tail,
+ * it is valid as long as the generator is alive.
+ */
+class CPUGenerator : public ngraph::snippets::Generator {
+public:
+    explicit CPUGenerator(mkldnn::impl::cpu::x64::cpu_isa_t isa);
+    ~CPUGenerator() override;
+
+    ngraph::snippets::code generate(std::shared_ptr<ngraph::Function>& f) const override;
+
+    size_t getVectorLength() const;
+
+private:
+    class jit_snippet;
+
+    std::unique_ptr<jit_snippet> h;
+    mkldnn::impl::cpu::x64::cpu_isa_t isa;
+};
+
+} // namespace MKLDNNPlugin
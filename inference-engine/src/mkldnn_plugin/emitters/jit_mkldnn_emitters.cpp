@@ -5,6 +5,8 @@
 #include "jit_mkldnn_emitters.hpp"
 #include "nodes/mkldnn_eltwise_node.h"
 
+#include <ngraph/opsets/opset1.hpp>
+
 using namespace mkldnn::impl::utils;
 using namespace mkldnn::impl;
 using namespace mkldnn::impl::cpu::x64;
@@ -14,12 +16,7 @@ namespace MKLDNNPlugin {
 
 jit_mkldnn_emitter::jit_mkldnn_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, InferenceEngine::Precision exec_prc)
     : jit_emitter(host, host_isa, node, exec_prc) {
-
-    kind = mkldnn_eltwise_tanh;
-    alpha = 0.f;
-    beta = 0.f;
-
-    set_injector();
+    // kind, alpha and beta are defined by the derived emitter which sets the injector afterwards
 }
 
 jit_mkldnn_emitter::jit_mkldnn_emitter(jit_generator *host, cpu_isa_t host_isa, const MKLDNNNode* node, InferenceEngine::Precision exec_prc)
@@ -84,4 +81,68 @@ jit_mkldnn_aux_emitter::jit_mkldnn_aux_emitter(jit_generator *host, cpu_isa_t ho
     : jit_mkldnn_emitter(host, host_isa, node, exec_prc) {
 }
 
+jit_relu_emitter::jit_relu_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, InferenceEngine::Precision exec_prc)
+    : jit_mkldnn_emitter(host, host_isa, node, exec_prc) {
+    kind = mkldnn_eltwise_relu;
+    alpha = 0.f;
+    beta = 0.f;
+
+    set_injector();
+}
+
+jit_sigmoid_emitter::jit_sigmoid_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, InferenceEngine::Precision exec_prc)
+    : jit_mkldnn_emitter(host, host_isa, node, exec_prc) {
+    kind = mkldnn_eltwise_logistic;
+    alpha = 0.f;
+    beta = 0.f;
+
+    set_injector();
+}
+
+jit_tanh_emitter::jit_tanh_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, InferenceEngine::Precision exec_prc)
+    : jit_mkldnn_emitter(host, host_isa, node, exec_prc) {
+    kind = mkldnn_eltwise_tanh;
+    alpha = 0.f;
+    beta = 0.f;
+
+    set_injector();
+}
+
+jit_elu_emitter::jit_elu_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, InferenceEngine::Precision exec_prc)
+    : jit_mkldnn_emitter(host, host_isa, node, exec_prc) {
+    kind = mkldnn_eltwise_elu;
+    alpha = static_cast<float>(ngraph::as_type_ptr<ngraph::op::v0::Elu>(node)->get_alpha());
+    beta = 0.f;
+
+    set_injector();
+}
+
+jit_exp_emitter::jit_exp_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, InferenceEngine::Precision exec_prc)
+    : jit_mkldnn_emitter(host, host_isa, node, exec_prc) {
+    kind = mkldnn_eltwise_exp;
+    alpha = 0.f;
+    beta = 0.f;
+
+    set_injector();
+}
+
+jit_abs_emitter::jit_abs_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, InferenceEngine::Precision exec_prc)
+    : jit_mkldnn_emitter(host, host_isa, node, exec_prc) {
+    kind = mkldnn_eltwise_abs;
+    alpha = 0.f;
+    beta = 0.f;
+
+    set_injector();
+}
+
+jit_clamp_emitter::jit_clamp_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, InferenceEngine::Precision exec_prc)
+    : jit_mkldnn_emitter(host, host_isa, node, exec_prc) {
+    auto clamp = ngraph::as_type_ptr<ngraph::op::v0::Clamp>(node);
+    kind = mkldnn_eltwise_clip;
+    alpha = static_cast<float>(clamp->get_min());
+    beta = static_cast<float>(clamp->get_max());
+
+    set_injector();
+}
+
 } // namespace MKLDNNPlugin
@@ -0,0 +1,231 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_snippets_emitters.hpp"
+
+#include <ngraph/variant.hpp>
+#include <snippets/snippets_isa.hpp>
+
+using namespace InferenceEngine;
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+namespace MKLDNNPlugin {
+
+/// MEMORY ///
+jit_snippets_memory_emitter::jit_snippets_memory_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node)
+: jit_emitter(host, host_isa, node) {
+    auto& rt = node->get_rt_info();
+    auto it = rt.find("effectiveAddress");
+    if (it == rt.end())
+        THROW_IE_EXCEPTION << "Snippet operation " << node->get_friendly_name() << " has no effective address assigned";
+    auto ea = ngraph::as_type_ptr<ngraph::VariantWrapper<int64_t>>(it->second);
+    if (!ea)
+        THROW_IE_EXCEPTION << "Snippet operation " << node->get_friendly_name() << " has incorrect effective address";
+    reg_ptr = Reg64(static_cast<int>(ea->get()));
+}
+
+/// LOAD ///
+jit_snippets_load_emitter::jit_snippets_load_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node)
+: jit_snippets_memory_emitter(host, host_isa, node) {}
+
+size_t jit_snippets_load_emitter::get_inputs_num() const { return 0; }
+
+void jit_snippets_load_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                          const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                          const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_vec_idxs, out_vec_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_snippets_load_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_dst = Vmm(out_vec_idxs[0]);
+
+    h->uni_vmovups(vmm_dst, h->ptr[reg_ptr]);
+    h->add(reg_ptr, get_vec_length());
+}
+
+/// SCALAR_LOAD ///
+jit_snippets_scalar_load_emitter::jit_snippets_scalar_load_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node)
+: jit_snippets_memory_emitter(host, host_isa, node) {}
+
+size_t jit_snippets_scalar_load_emitter::get_inputs_num() const { return 0; }
+
+void jit_snippets_scalar_load_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                                 const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                                 const emitter_context *emit_context) const {
+    h->uni_vmovss(Xmm(out_vec_idxs[0]), h->ptr[reg_ptr]);
+    h->add(reg_ptr, sizeof(float));
+}
+
+/// BROADCAST_LOAD ///
+jit_snippets_broadcast_load_emitter::jit_snippets_broadcast_load_emitter(jit_generator *host, cpu_isa_t host_isa,
+                                                                         const std::shared_ptr<ngraph::Node>& node)
+: jit_snippets_memory_emitter(host, host_isa, node) {}
+
+size_t jit_snippets_broadcast_load_emitter::get_inputs_num() const { return 0; }
+
+void jit_snippets_broadcast_load_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                                    const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                                    const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_vec_idxs, out_vec_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_snippets_broadcast_load_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_dst = Vmm(out_vec_idxs[0]);
+
+    // the source is broadcasted along the innermost dimension, so the pointer stays in place
+    h->uni_vbroadcastss(vmm_dst, h->ptr[reg_ptr]);
+}
+
+/// STORE ///
+jit_snippets_store_emitter::jit_snippets_store_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node)
+: jit_snippets_memory_emitter(host, host_isa, node) {}
+
+size_t jit_snippets_store_emitter::get_inputs_num() const { return 1; }
+
+void jit_snippets_store_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                           const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                           const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_vec_idxs, out_vec_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_snippets_store_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_src = Vmm(in_vec_idxs[0]);
+
+    h->uni_vmovups(h->ptr[reg_ptr], vmm_src);
+    h->add(reg_ptr, get_vec_length());
+}
+
+/// SCALAR_STORE ///
+jit_snippets_scalar_store_emitter::jit_snippets_scalar_store_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node)
+: jit_snippets_memory_emitter(host, host_isa, node) {}
+
+size_t jit_snippets_scalar_store_emitter::get_inputs_num() const { return 1; }
+
+void jit_snippets_scalar_store_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                                  const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                                  const emitter_context *emit_context) const {
+    h->uni_vmovss(h->ptr[reg_ptr], Xmm(in_vec_idxs[0]));
+    h->add(reg_ptr, sizeof(float));
+}
+
+/// BROADCAST_MOVE ///
+jit_snippets_broadcast_move_emitter::jit_snippets_broadcast_move_emitter(jit_generator *host, cpu_isa_t host_isa,
+                                                                         const std::shared_ptr<ngraph::Node>& node)
+: jit_emitter(host, host_isa, node) {
+    const auto& inShape = node->get_input_shape(0);
+    const auto& outShape = node->get_output_shape(0);
+    broadcastLane = !inShape.empty() && !outShape.empty() && inShape.back() == 1 && outShape.back() != 1;
+}
+
+size_t jit_snippets_broadcast_move_emitter::get_inputs_num() const { return 1; }
+
+void jit_snippets_broadcast_move_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                                    const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                                    const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_vec_idxs, out_vec_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_snippets_broadcast_move_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Xmm xmm_src = Xmm(in_vec_idxs[0]);
+    Vmm vmm_src = Vmm(in_vec_idxs[0]);
+    Vmm vmm_dst = Vmm(out_vec_idxs[0]);
+
+    if (!broadcastLane) {
+        if (out_vec_idxs[0] != in_vec_idxs[0])
+            h->uni_vmovups(vmm_dst, vmm_src);
+        return;
+    }
+
+    if (isa == cpu::x64::sse41) {
+        if (out_vec_idxs[0] != in_vec_idxs[0])
+            h->uni_vmovups(vmm_dst, vmm_src);
+        h->shufps(vmm_dst, vmm_dst, 0x0);
+    } else {
+        h->vbroadcastss(vmm_dst, xmm_src);
+    }
+}
+
+/// SCALAR ///
+jit_snippets_scalar_emitter::jit_snippets_scalar_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node)
+: jit_emitter(host, host_isa, node) {
+    auto scalar = ngraph::as_type_ptr<ngraph::snippets::op::Scalar>(node);
+    if (!scalar)
+        THROW_IE_EXCEPTION << "Snippet operation " << node->get_friendly_name() << " is not a scalar";
+    value = scalar->cast_vector<float>()[0];
+
+    prepare_table();
+}
+
+size_t jit_snippets_scalar_emitter::get_inputs_num() const { return 0; }
+
+void jit_snippets_scalar_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                            const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                            const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_vec_idxs, out_vec_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_snippets_scalar_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_dst = Vmm(out_vec_idxs[0]);
+
+    h->uni_vmovups(vmm_dst, table_val("scalar"));
+}
+
+void jit_snippets_scalar_emitter::register_table_entries() {
+    push_arg_entry_of("scalar", float2int(value), true);
+}
+
+} // namespace MKLDNNPlugin
@@ -0,0 +1,116 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_arena.h"
+
+#include <blob_factory.hpp>
+#include <ie_allocator.hpp>
+#include <details/ie_exception.hpp>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+constexpr size_t arenaAlignment = 64;
+
+size_t alignUp(size_t size) {
+    return (size + arenaAlignment - 1) / arenaAlignment * arenaAlignment;
+}
+
+}  // namespace
+
+MKLDNNArenaStatistics::Guard::Guard(Ptr statistics, size_t size) : statistics(std::move(statistics)), size(size) {
+    if (this->statistics)
+        this->statistics->allocated(size);
+}
+
+MKLDNNArenaStatistics::Guard::~Guard() {
+    if (statistics)
+        statistics->released(size);
+}
+
+void MKLDNNArenaStatistics::allocated(size_t size) {
+    auto current = currentSize += size;
+    auto peak = peakSize.load();
+    while (current > peak && !peakSize.compare_exchange_weak(peak, current)) {}
+}
+
+void MKLDNNArenaStatistics::released(size_t size) {
+    currentSize -= size;
+}
+
+struct MKLDNNArena::Buffer {
+    Buffer(size_t size, MKLDNNArenaStatistics::Ptr statistics, bool zeroed)
+        : storage(zeroed ? new uint8_t[size + arenaAlignment - 1]() : new uint8_t[size + arenaAlignment - 1])
+        , guard(std::move(statistics), size) {
+        auto address = reinterpret_cast<uintptr_t>(storage.get());
+        data = storage.get() + (alignUp(address) - address);
+    }
+
+    std::unique_ptr<uint8_t[]> storage;
+    uint8_t* data = nullptr;
+    MKLDNNArenaStatistics::Guard guard;
+};
+
+namespace {
+
+/**
+ * Provides a preallocated part of the arena to a blob and keeps the arena alive
+ */
+class ArenaSliceAllocator : public IAllocator {
+public:
+    ArenaSliceAllocator(std::shared_ptr<void> buffer, void* slice) : buffer(std::move(buffer)), slice(slice) {}
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t) noexcept override {
+        return slice;
+    }
+
+    bool free(void*) noexcept override {
+        return true;
+    }
+
+private:
+    std::shared_ptr<void> buffer;
+    void* slice;
+};
+
+}  // namespace
+
+MKLDNNArena::MKLDNNArena(MKLDNNArenaStatistics::Ptr statistics) : statistics(std::move(statistics)) {}
+
+size_t MKLDNNArena::reserve(const TensorDesc& desc) {
+    if (buffer)
+        THROW_IE_EXCEPTION << "Cannot reserve a place in the arena which is already allocated";
+
+    size_t byteSize = desc.getPrecision().size();
+    for (auto dim : desc.getBlockingDesc().getBlockDims())
+        byteSize *= dim;
+    byteSize += desc.getBlockingDesc().getOffsetPadding() * desc.getPrecision().size();
+
+    blobs.emplace_back(desc, size);
+    size += alignUp(byteSize);
+    return blobs.size() - 1;
+}
+
+void MKLDNNArena::allocate(bool zeroed) {
+    buffer = std::make_shared<Buffer>(size, statistics, zeroed);
+}
+
+Blob::Ptr MKLDNNArena::getBlob(size_t index) const {
+    if (!buffer)
+        THROW_IE_EXCEPTION << "The arena is not allocated";
+
+    const auto& blob = blobs.at(index);
+    auto allocator = std::make_shared<ArenaSliceAllocator>(buffer, buffer->data + blob.second);
+    auto result = make_blob_with_precision(blob.first, allocator);
+    result->allocate();
+    return result;
+}
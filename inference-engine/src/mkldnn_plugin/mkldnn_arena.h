@@ -0,0 +1,98 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_blob.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Tracks total size of memory arenas of an executable network and its peak value
+ *
+ * Is a thread safe
+ */
+class MKLDNNArenaStatistics {
+public:
+    typedef std::shared_ptr<MKLDNNArenaStatistics> Ptr;
+
+    /**
+     * Accounts a memory block in the statistics while the guard is alive
+     */
+    class Guard {
+    public:
+        Guard(Ptr statistics, size_t size);
+        ~Guard();
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+    private:
+        Ptr statistics;
+        size_t size;
+    };
+
+    size_t getCurrentSize() const {
+        return currentSize;
+    }
+
+    size_t getPeakSize() const {
+        return peakSize;
+    }
+
+private:
+    void allocated(size_t size);
+    void released(size_t size);
+
+    std::atomic<size_t> currentSize {0};
+    std::atomic<size_t> peakSize {0};
+};
+
+/**
+ * Single memory buffer holding a set of blobs
+ *
+ * Places for blobs are reserved first, then the whole buffer is allocated at once.
+ * Created blobs share the ownership of the buffer, so they stay valid after the arena is destroyed.
+ */
+class MKLDNNArena {
+public:
+    explicit MKLDNNArena(MKLDNNArenaStatistics::Ptr statistics = nullptr);
+
+    /**
+     * Reserves an aligned place for the blob
+     * @return index of the blob in the arena
+     */
+    size_t reserve(const InferenceEngine::TensorDesc& desc);
+
+    /**
+     * Allocates the buffer for all the reserved places
+     * @param zeroed zero the buffer, so its pages are placed on the NUMA node of the allocating thread rather than
+     *        on the node of the thread that happens to write into the blobs first
+     */
+    void allocate(bool zeroed = false);
+
+    /**
+     * Creates a blob located in the arena, must be called after allocate()
+     */
+    InferenceEngine::Blob::Ptr getBlob(size_t index) const;
+
+    size_t getSize() const {
+        return size;
+    }
+
+private:
+    struct Buffer;
+
+    MKLDNNArenaStatistics::Ptr statistics;
+    std::vector<std::pair<InferenceEngine::TensorDesc, size_t>> blobs;
+    size_t size = 0;
+    std::shared_ptr<Buffer> buffer;
+};
+
+}  // namespace MKLDNNPlugin
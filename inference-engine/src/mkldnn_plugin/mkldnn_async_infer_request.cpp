@@ -5,11 +5,27 @@
 #include "mkldnn_async_infer_request.h"
 #include <memory>
 
+namespace {
+// Runs the tasks in place, in the stream of the calling thread
+struct StreamExecuteExecutor : public InferenceEngine::ITaskExecutor {
+    explicit StreamExecuteExecutor(const InferenceEngine::IStreamsExecutor::Ptr& streamsExecutor) : _streamsExecutor{streamsExecutor} {}
+    void run(InferenceEngine::Task task) override {_streamsExecutor->Execute(std::move(task));}
+    InferenceEngine::IStreamsExecutor::Ptr _streamsExecutor;
+};
+}  // namespace
+
 MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr& inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
-                                                               const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
+                                                               const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor,
+                                                               const InferenceEngine::IStreamsExecutor::Ptr& syncStreamsExecutor)
     : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
     static_cast<MKLDNNInferRequest*>(inferRequest.get())->SetAsyncRequest(this);
+    // The task executor is not a streams one if it only routes the tasks to some streams, so the base class would run
+    // the synchronous inference on the calling thread outside of any stream. It is run in the stream of the thread instead
+    if (nullptr != syncStreamsExecutor) {
+        auto syncRequest = inferRequest.get();
+        _syncPipeline = {{std::make_shared<StreamExecuteExecutor>(syncStreamsExecutor), [syncRequest] {syncRequest->InferImpl();}}};
+    }
 }
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
@@ -15,7 +15,8 @@ class MKLDNNAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadS
 public:
     MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr &inferRequest,
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
-                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
+                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
+                            const InferenceEngine::IStreamsExecutor::Ptr &syncStreamsExecutor = nullptr);
     ~MKLDNNAsyncInferRequest() override;
 };
 
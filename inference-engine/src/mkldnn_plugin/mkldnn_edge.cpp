@@ -174,7 +174,7 @@ std::string MKLDNNEdge::name() const {
     return parentPtr->getName() + std::to_string(parent_port) + "<->" + childPtr->getName() + std::to_string(child_port);
 }
 
-void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache) {
+void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache, const std::string& key) {
     if (status != Status::NeedAllocation)
         return;
 
@@ -184,9 +184,10 @@ void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache) {
             return memoryPtr;
         };
 
-        auto ptr = weightsCache->findOrCreate(name(), alloc, false);
+        auto ptr = weightsCache->findOrCreate(key, alloc, false);
         memoryPtr = *ptr;
         externalMemoryPtr = true;
+        externalMemoryKey = key;
         status = Status::Allocated;
     } else {
         allocate();
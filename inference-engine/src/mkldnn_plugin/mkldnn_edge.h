@@ -14,6 +14,7 @@
 
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace MKLDNNPlugin {
@@ -46,7 +47,7 @@ public:
 
     void init();
     void allocate(const void* mem_ptr = nullptr);
-    void externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache);
+    void externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache, const std::string& key);
     void validate();
     void drop();
 
@@ -81,6 +82,7 @@ private:
     int child_port;
 
     bool externalMemoryPtr = false;
+    std::string externalMemoryKey;
     MKLDNNEdgeWeakPtr memoryFromEdge;
     MKLDNNDims dims;
     MKLDNNMemoryPtr memoryPtr;
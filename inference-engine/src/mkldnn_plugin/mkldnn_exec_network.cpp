@@ -24,11 +24,34 @@
 #include <utility>
 #include <cstring>
 #include <legacy/details/ie_cnn_network_tools.h>
+#include <transformations/serialize.hpp>
+#include <xml_parse_utils.h>
+#include <sstream>
+#include <cstdint>
+#include <future>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+// Starts the tasks on the streams of a single NUMA node
+class NumaNodeTaskExecutor : public ITaskExecutor {
+public:
+    NumaNodeTaskExecutor(const IStreamsExecutor::Ptr& streamsExecutor, int numaNodeId) :
+        _streamsExecutor{streamsExecutor},
+        _numaNodeId{numaNodeId} {}
+
+    void run(Task task) override {
+        _streamsExecutor->RunOnNumaNode(_numaNodeId, std::move(task));
+    }
+
+private:
+    IStreamsExecutor::Ptr   _streamsExecutor;
+    int                     _numaNodeId;
+};
+}  // namespace
+
 InferenceEngine::InferRequestInternal::Ptr
 MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                                           InferenceEngine::OutputsDataMap networkOutputs) {
@@ -38,18 +61,112 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const InferenceEngine::CNNNetwork &sourceNetwork,
+                                     const NetworkTransformer &transformNetwork) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
+    _sourceNetwork{sourceNetwork},
     _cfg{cfg},
     _name{network.getName()},
-    _numaNodesWeights(numaNodesWeights) {
+    _numaNodesWeights(numaNodesWeights),
+    _transformNetwork{transformNetwork},
+    _shapeCacheCapacity{static_cast<std::size_t>(cfg.shapeCacheCapacity)} {
     OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork", "cloneNet");
 
-    // we are cloning network if we have statistics and we can transform network.
-    _clonedNetwork = cloneNetwork(network);
+    // The network is a private copy made by Engine::LoadExeNetworkImpl, so it is transformed in place
+    // instead of one more deep copy of all layers
+    _clonedNetwork = network;
+    OV_ITT_TASK_NEXT(taskChain, "PrepareNetwork");
+
+    PrepareNetwork(_clonedNetwork, _cfg);
+
+    OV_ITT_TASK_SKIP(taskChain);
+
+    // Graphs for other input shapes are compiled from the nGraph function, so it is not available for legacy
+    // networks. Dynamic batch and memory states are bound to the graph of the loaded network.
+    if (_shapeCacheCapacity > 0 && _transformNetwork && _sourceNetwork.getFunction() &&
+        _sourceNetwork.getFunction()->get_sinks().empty() && _cfg.batchLimit == 0) {
+        for (auto&& input : _clonedNetwork.getInputsInfo()) {
+            _inputShapes[input.first] = input.second->getTensorDesc().getDims();
+        }
+        _canSwitchShapes = true;
+    }
+
+    if (_cfg.batchLimit > 1) {
+        // check topology for applicability
+        if (!CanProcessDynBatch(_clonedNetwork)) {
+            THROW_IE_EXCEPTION << "MKLDNNGraph::CreateGraph: such topology cannot be compiled for dynamic batch!";
+        }
+    }
+
+    if (cfg.exclusiveAsyncRequests) {
+        // special case when all InferRequests are muxed into a single queue
+        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
+    } else {
+        auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig);
+        streamsExecutorConfig._name = "CPUStreamsExecutor";
+        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+    }
+    if (0 != cfg.streamExecutorConfig._streams) {
+        _callbackExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
+    } else {
+        _callbackExecutor = _taskExecutor;
+    }
+
+    // the executor binds the streams to the first NUMA nodes, the requests and their blobs are spread over the same nodes
+    auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(_taskExecutor);
+    const auto& numaNodes = getAvailableNUMANodes();
+    if (cfg.numaPlacement && !cfg.exclusiveAsyncRequests && nullptr != streamsExecutor && numaNodes.size() > 1 &&
+        _cfg.streamExecutorConfig._streams > 1 &&
+        IStreamsExecutor::ThreadBindingType::NUMA == _cfg.streamExecutorConfig._threadBindingType) {
+        _numaNodes.assign(numaNodes.begin(),
+            numaNodes.begin() + std::min(numaNodes.size(), static_cast<std::size_t>(_cfg.streamExecutorConfig._streams)));
+        for (auto numaNodeId : _numaNodes) {
+            _numaNodeExecutors.push_back(std::make_shared<NumaNodeTaskExecutor>(streamsExecutor, numaNodeId));
+        }
+    }
 
-    if (_cfg.lpTransformsMode == Config::LPTransformsMode::On) {
+    int streams = std::max(1, _cfg.streamExecutorConfig._streams);
+    std::vector<Task> tasks; tasks.resize(streams);
+    _graphs.resize(streams);
+    if (_cfg.streamExecutorConfig._streams != 0) {
+        for (auto&& task : tasks) {
+            task = [this] {
+                MKLDNNExecNetwork::GetGraph();
+            };
+        }
+        _taskExecutor->runAndWait(tasks);
+    } else {
+        MKLDNNExecNetwork::GetGraph();
+    }
+
+    // Save all MemoryLayer data tensors. Will use insight about mechanics
+    // of MemoryLayer implementation. It uses output edge of MemoryLayer
+    // producer as storage for tensor to keep it between infer calls.
+    if (_graphs.size() == 1) {
+        for (auto &node : GetGraph()._graph.GetNodes()) {
+            if (node->getType() == MemoryInput) {
+                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+                auto state_store = memoryNode->getStore();
+                auto state_name = memoryNode->getId();
+
+                // Remove suffix with pair ID. Internal information.
+                auto suffix_idx = state_name.find("/id=");
+                if (suffix_idx != std::string::npos)
+                    state_name = state_name.substr(0, suffix_idx);
+
+                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+            }
+        }
+    }
+}
+
+void MKLDNNExecNetwork::PrepareNetwork(InferenceEngine::CNNNetwork& network, const Config& cfg) {
+    OV_ITT_SCOPED_TASK(MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork::PrepareNetwork");
+
+    if (cfg.lpTransformsMode == Config::LPTransformsMode::On) {
         // Check if network is INT8 or Binary.
         // BF16 transformations were disabled since CPU plug-in doesn't support mixed precision execution:
         // BF16 + INT8 or BF16 + BIN.
@@ -64,9 +181,9 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
 
         auto changePrecisionBF16 = [&](Precision current, Precision target) {
-            InputsDataMap inputs = _clonedNetwork.getInputsInfo();
-            OutputsDataMap outputs = _clonedNetwork.getOutputsInfo();
-            CNNNetworkIterator iter(_clonedNetwork);
+            InputsDataMap inputs = network.getInputsInfo();
+            OutputsDataMap outputs = network.getOutputsInfo();
+            CNNNetworkIterator iter(network);
             while (iter != CNNNetworkIterator()) {
                 //  check, if memory output node needs to be transformed
                 if (current == Precision::FP32 &&
@@ -89,7 +206,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
 
         if (with_cpu_x86_avx512_core() && isFloatModel) {
             // If enforceBF16 flag was set, BF16 transformation applies for all layers supported by CPU plugin.
-            // Otherwise, only layers marked as BF16 in '_clonedNetwork' will be performed in bfloat16 mode.
+            // Otherwise, only layers marked as BF16 in 'network' will be performed in bfloat16 mode.
             // CPU plugin throws an exception, if marked as BF16 layers have not supported by CPU plugin.
             if (cfg.enforceBF16 == true)
                 changePrecisionBF16(Precision::FP32, Precision::BF16);
@@ -98,7 +215,6 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
     }
 
-    OV_ITT_TASK_NEXT(taskChain, "createConstInputs");
     auto createConstInputTo = [&](CNNLayerPtr layer, Blob::Ptr blob, const std::vector<size_t>& shape, const std::string& name) {
         LayerParams attrs = {layer->name + "_const_" + name, "Const", blob->getTensorDesc().getPrecision()};
         auto constLayer = std::make_shared<InferenceEngine::CNNLayer>(attrs);
@@ -112,7 +228,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         getInputTo(newEdgeAfterLayer).clear();
 
         IE_SUPPRESS_DEPRECATED_START
-        auto icnnnet = static_cast<ICNNNetwork::Ptr>(_clonedNetwork);
+        auto icnnnet = static_cast<ICNNNetwork::Ptr>(network);
         IE_SUPPRESS_DEPRECATED_END
         auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(icnnnet);
         IE_ASSERT(implNetwork != nullptr);
@@ -126,7 +242,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
 
     // The code block below transforms legacy layers to the form more compatible with opset1 in order to simplify future migration
     // TODO: remove after plug-in is migrated on opset1
-    auto all_layers = details::CNNNetSortTopologically(_clonedNetwork);
+    auto all_layers = details::CNNNetSortTopologically(network);
     for (auto &layer : all_layers) {
         if (layer->type == "ScaleShift" && layer->insData.size() == 1) {
             auto constDimsRank = layer->insData[0].lock()->getDims().size();
@@ -215,67 +331,22 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
             }
         }
     }
+}
 
-    OV_ITT_TASK_SKIP(taskChain);
-
-    if (_cfg.batchLimit > 1) {
-        // check topology for applicability
-        if (!CanProcessDynBatch(_clonedNetwork)) {
-            THROW_IE_EXCEPTION << "MKLDNNGraph::CreateGraph: such topology cannot be compiled for dynamic batch!";
-        }
-    }
-
-    if (cfg.exclusiveAsyncRequests) {
-        // special case when all InferRequests are muxed into a single queue
-        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
-    } else {
-        auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig);
-        streamsExecutorConfig._name = "CPUStreamsExecutor";
-        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
-    }
-    if (0 != cfg.streamExecutorConfig._streams) {
-        _callbackExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
-            IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
-    } else {
-        _callbackExecutor = _taskExecutor;
-    }
-
-    int streams = std::max(1, _cfg.streamExecutorConfig._streams);
-    std::vector<Task> tasks; tasks.resize(streams);
-    _graphs.resize(streams);
-    if (_cfg.streamExecutorConfig._streams != 0) {
-        for (auto&& task : tasks) {
-            task = [this] {
-                MKLDNNExecNetwork::GetGraph();
-            };
-        }
-        _taskExecutor->runAndWait(tasks);
-    } else {
-        MKLDNNExecNetwork::GetGraph();
-    }
-
-    // Save all MemoryLayer data tensors. Will use insight about mechanics
-    // of MemoryLayer implementation. It uses output edge of MemoryLayer
-    // producer as storage for tensor to keep it between infer calls.
-    if (_graphs.size() == 1) {
-        for (auto &node : GetGraph()._graph.GetNodes()) {
-            if (node->getType() == MemoryInput) {
-                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-                auto state_store = memoryNode->getStore();
-                auto state_name = memoryNode->getId();
-
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
+MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
+    return GetGraph(_graphs, _clonedNetwork);
+}
 
-                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
-            }
-        }
+MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph(const InputShapes& shapes, std::shared_ptr<ShapeGraphs>& owner) {
+    if (!_canSwitchShapes || shapes == _inputShapes) {
+        owner = nullptr;
+        return GetGraph();
     }
+    owner = GetShapeGraphs(shapes);
+    return GetGraph(owner->_graphs, owner->_network);
 }
 
-MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
+MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph(std::deque<Graph>& graphs, const CNNNetwork& network) {
     int streamId = 0;
     int numaNodeId = 0;
     auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
@@ -283,25 +354,52 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
         streamId = streamsExecutor->GetStreamId();
         numaNodeId = streamsExecutor->GetNumaNodeId();
     }
-    auto graphLock = Graph::Lock(_graphs[streamId % _graphs.size()]);
+    auto& graph = graphs[streamId % graphs.size()];
+    auto makeGraph = [&] (MKLDNNGraph& newGraph) {
+        // Every graph is built from own copy of layers. Replicate() updates the precision of input layers
+        // and nodes keep the layers they are created from, so the network is left intact for the
+        // other graphs and for the legacy export of the network
+        auto localNetwork = cloneNetwork(network);
+        {
+            std::lock_guard<std::mutex> lock{_cfgMutex};
+            newGraph.setConfig(_cfg);
+        }
+        newGraph.arenaStatistics = _arenaStatistics;
+        newGraph.firstTouchWorkspace = !_numaNodes.empty();
+        // constants of all shape variants are looked up in the same weights cache, so they are shared
+        newGraph.CreateGraph(localNetwork, extensionManager, _numaNodesWeights[numaNodeId]);
+    };
+    // Stream ids of external threads follow the ids of the stream workers. The graph for an external thread
+    // is built by a worker of the graph NUMA node, so the workspace and the weights are allocated on the node
+    if (!_numaNodes.empty() && streamId >= static_cast<int>(graphs.size())) {
+        bool isReady = false;
+        {
+            Graph::Lock graphLock{graph};
+            isReady = graphLock._graph.IsReady();
+        }
+        if (!isReady) {
+            RunOnNumaNode(numaNodeId, [&] {
+                Graph::Lock graphLock{graph};
+                if (!graphLock._graph.IsReady()) {
+                    makeGraph(graphLock._graph);
+                }
+            });
+        }
+    }
+    auto graphLock = Graph::Lock(graph);
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
-        auto makeGraph = [&] {
+        auto task = [&] {
             try {
-                auto localNetwork = cloneNetwork(_clonedNetwork);
-                {
-                    std::lock_guard<std::mutex> lock{_cfgMutex};
-                    graphLock._graph.setConfig(_cfg);
-                }
-                graphLock._graph.CreateGraph(localNetwork, extensionManager, _numaNodesWeights[numaNodeId]);
+                makeGraph(graphLock._graph);
             } catch(...) {
                 exception = std::current_exception();
             }
         };
         if (nullptr != streamsExecutor) {
-            streamsExecutor->Execute(makeGraph);
+            streamsExecutor->Execute(task);
         } else {
-            makeGraph();
+            task();
         }
         if (exception) {
             std::rethrow_exception(exception);
@@ -310,6 +408,70 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
     return graphLock;
 }
 
+void MKLDNNExecNetwork::RunOnNumaNode(int numaNodeId, const Task& task) {
+    auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    // workers have stream ids below the number of graphs
+    if (_numaNodes.empty() || nullptr == streamsExecutor ||
+        (streamsExecutor->GetStreamId() < static_cast<int>(_graphs.size()) && streamsExecutor->GetNumaNodeId() == numaNodeId)) {
+        task();
+        return;
+    }
+    std::packaged_task<void()> packagedTask{task};
+    auto future = packagedTask.get_future();
+    streamsExecutor->RunOnNumaNode(numaNodeId, [&packagedTask] {
+        packagedTask();
+    });
+    future.get();
+}
+
+std::shared_ptr<MKLDNNExecNetwork::ShapeGraphs> MKLDNNExecNetwork::GetShapeGraphs(const InputShapes& shapes) {
+    auto find = [&] {
+        auto found = std::find_if(_shapeGraphs.begin(), _shapeGraphs.end(), [&] (const decltype(_shapeGraphs)::value_type& entry) {
+            return entry.first == shapes;
+        });
+        if (found == _shapeGraphs.end()) {
+            return std::shared_ptr<ShapeGraphs>{};
+        }
+        _shapeGraphs.splice(_shapeGraphs.begin(), _shapeGraphs, found);
+        return found->second;
+    };
+    {
+        std::lock_guard<std::mutex> lock{_shapeGraphsMutex};
+        auto shapeGraphs = find();
+        if (shapeGraphs) {
+            return shapeGraphs;
+        }
+    }
+
+    // the network is prepared without the lock, so requests with cached shapes are not blocked
+    OV_ITT_SCOPED_TASK(MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork::GetShapeGraphs");
+    auto network = InferenceEngine::cloneNetwork(_sourceNetwork);
+    network.reshape(shapes);
+    _transformNetwork(network);
+    Config cfg;
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        cfg = _cfg;
+    }
+    PrepareNetwork(network, cfg);
+
+    auto shapeGraphs = std::make_shared<ShapeGraphs>();
+    shapeGraphs->_network = network;
+    shapeGraphs->_graphs.resize(_graphs.size());
+
+    std::lock_guard<std::mutex> lock{_shapeGraphsMutex};
+    // another request may have prepared the same shapes meanwhile
+    auto cached = find();
+    if (cached) {
+        return cached;
+    }
+    _shapeGraphs.emplace_front(shapes, shapeGraphs);
+    if (_shapeGraphs.size() > _shapeCacheCapacity) {
+        _shapeGraphs.pop_back();
+    }
+    return shapeGraphs;
+}
+
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
     {
         std::lock_guard<std::mutex> lock{_cfgMutex};
@@ -321,10 +483,31 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
             graphLock._graph.setProperty(properties);
         }
     }
+    std::lock_guard<std::mutex> lock{_shapeGraphsMutex};
+    for (auto& entry : _shapeGraphs) {
+        for (auto& g : entry.second->_graphs) {
+            auto graphLock = Graph::Lock(g);
+            if (graphLock._graph.IsReady()) {
+                graphLock._graph.setProperty(properties);
+            }
+        }
+    }
 }
 
 InferenceEngine::IInferRequest::Ptr MKLDNNExecNetwork::CreateInferRequest() {
-    return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+    if (_numaNodes.empty()) {
+        return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+    }
+    // the requests are spread over the NUMA nodes round-robin, a request keeps its blobs and runs its inference on its node
+    const auto numaNodeIdx = _nextNumaNode++ % _numaNodes.size();
+    auto syncRequestImpl = std::make_shared<MKLDNNInferRequest>(_networkInputs, _networkOutputs,
+        std::static_pointer_cast<MKLDNNExecNetwork>(shared_from_this()), _numaNodes[numaNodeIdx]);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    auto asyncThreadSafeImpl = std::make_shared<MKLDNNAsyncInferRequest>(
+        syncRequestImpl, _numaNodeExecutors[numaNodeIdx], _callbackExecutor, std::dynamic_pointer_cast<IStreamsExecutor>(_taskExecutor));
+    IInferRequest::Ptr asyncRequest = std::make_shared<InferRequestBase>(asyncThreadSafeImpl);
+    asyncThreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
+    return asyncRequest;
 }
 
 InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
@@ -359,6 +542,8 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(EXEC_NETWORK_METRIC_KEY(PEAK_MEMORY_ARENA_SIZE));
+        metrics.push_back(EXEC_NETWORK_METRIC_KEY(MEMORY_SOLVER_STATISTICS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -373,6 +558,15 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == EXEC_NETWORK_METRIC_KEY(PEAK_MEMORY_ARENA_SIZE)) {
+        IE_SET_METRIC_RETURN(PEAK_MEMORY_ARENA_SIZE, static_cast<uint64_t>(_arenaStatistics->getPeakSize()));
+    } else if (name == EXEC_NETWORK_METRIC_KEY(MEMORY_SOLVER_STATISTICS)) {
+        auto graphLock = const_cast<MKLDNNExecNetwork*>(this)->GetGraph();
+        std::map<std::string, uint64_t> statistics = {
+            {"SOLVED_SIZE", graphLock._graph.getWorkspaceSize()},
+            {"LOWER_BOUND", graphLock._graph.getWorkspaceLowerBound()},
+        };
+        IE_SET_METRIC_RETURN(MEMORY_SOLVER_STATISTICS, statistics);
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -399,14 +593,30 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &ne
         if (tileLayer && tileLayer->axis)
             return;
 
-        auto reshapeLayer = dynamic_cast<ReshapeLayer *>(layer.get());
-        if (reshapeLayer &&
-            type == Reshape &&
-            (reshapeLayer->outData[0]->getTensorDesc().getDims()[0] ==
-             reshapeLayer->insData[0].lock()->getTensorDesc().getDims()[0])) {
+        // Reshapes keeping the batch dimension are in-place views of the input
+        if ((type == Reshape || type == Flatten) && !layer->outData.empty() && !layer->insData.empty() &&
+            !layer->outData[0]->getTensorDesc().getDims().empty() &&
+            !layer->insData[0].lock()->getTensorDesc().getDims().empty() &&
+            (layer->outData[0]->getTensorDesc().getDims()[0] ==
+             layer->insData[0].lock()->getTensorDesc().getDims()[0])) {
             return;
         }
 
+        if (type == Permute) {
+            auto order = layer->GetParamAsInts("order", {});
+            if (!order.empty() && order[0] == 0)
+                return;
+        }
+
+        // Detection layers process the images of the batch independently and get the inputs limited
+        // to the processed batch, so detections of the images beyond it are not reported.
+        // Prior boxes depend on the spatial dimensions only.
+        static const std::unordered_set<std::string> batchIndependentLayers = {
+            "DetectionOutput", "RegionYolo", "ReorgYolo", "PriorBox", "PriorBoxClustered"
+        };
+        if (batchIndependentLayers.count(layer->type) != 0)
+            return;
+
         if (type != Input &&
             type != Output &&
             type != Convolution &&
@@ -431,6 +641,85 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &ne
     return check_result;
 }
 
+bool MKLDNNExecNetwork::CanExportLegacyNetwork(const InferenceEngine::CNNNetwork& network) {
+    for (CNNNetworkIterator iter(network); iter != CNNNetworkIterator(); iter++) {
+        if (dynamic_cast<TensorIterator*>((*iter).get()) != nullptr)
+            return false;
+    }
+    // the legacy IR has no list of outputs, the reader makes outputs of the data without consumers only
+    for (auto&& output : network.getOutputsInfo()) {
+        if (!getInputTo(output.second).empty())
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNExecNetwork::ExportImpl(std::ostream& networkModel) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::ExportImpl");
+    // The legacy network is the result of all transformations, so its import compiles only the graph.
+    // The nGraph network is exported if graphs of other input shapes are compiled from it.
+    const bool exportLegacy = !_canSwitchShapes && CanExportLegacyNetwork(_clonedNetwork);
+    if (!exportLegacy && !_sourceNetwork.getFunction()) {
+        THROW_IE_EXCEPTION_WITH_STATUS(NOT_IMPLEMENTED) << "CPU plugin can't export legacy networks with TensorIterator layers";
+    }
+
+    pugi::xml_document doc;
+    auto cpuNode = doc.append_child("cpu");
+    cpuNode.append_attribute("name").set_value(_name.c_str());
+    cpuNode.append_attribute("graph").set_value(exportLegacy ? "legacy" : "ngraph");
+
+    auto inputsNode = cpuNode.append_child("inputs");
+    for (auto&& networkInput : _networkInputs) {
+        auto inputNode = inputsNode.append_child("input");
+        inputNode.append_attribute("name").set_value(networkInput.first.c_str());
+        inputNode.append_attribute("precision").set_value(networkInput.second->getPrecision().name());
+        inputNode.append_attribute("layout").set_value(static_cast<int>(networkInput.second->getLayout()));
+    }
+
+    auto outputsNode = cpuNode.append_child("outputs");
+    for (auto&& networkOutput : _networkOutputs) {
+        auto outputNode = outputsNode.append_child("output");
+        outputNode.append_attribute("name").set_value(networkOutput.first.c_str());
+        outputNode.append_attribute("precision").set_value(networkOutput.second->getPrecision().name());
+        outputNode.append_attribute("layout").set_value(static_cast<int>(networkOutput.second->getLayout()));
+    }
+
+    auto configsNode = cpuNode.append_child("configs");
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        for (auto&& config : _cfg._config) {
+            auto configNode = configsNode.append_child("config");
+            configNode.append_attribute("key").set_value(config.first.c_str());
+            configNode.append_attribute("value").set_value(config.second.c_str());
+        }
+    }
+
+    doc.save(networkModel, nullptr, pugi::format_raw);
+    doc.reset();
+    networkModel << std::endl;
+
+    std::stringstream xmlFile, binFile;
+    if (exportLegacy) {
+        // the serializer updates parameters of layers, so the network used by the graphs is not touched
+        InferenceEngine::serializeLegacyNetwork(InferenceEngine::cloneNetwork(_clonedNetwork), xmlFile, binFile);
+    } else {
+        // Note: custom ngraph extensions are not supported
+        ngraph::pass::Serialize serializer(xmlFile, binFile, ngraph::pass::Serialize::Version::IR_V10);
+        serializer.run_on_function(_sourceNetwork.getFunction());
+    }
+
+    auto m_constants = binFile.str();
+    auto m_model = xmlFile.str();
+
+    auto dataSize = static_cast<std::uint64_t>(m_model.size());
+    networkModel.write(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+    networkModel.write(m_model.c_str(), dataSize);
+
+    dataSize = static_cast<std::uint64_t>(m_constants.size());
+    networkModel.write(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+    networkModel.write(&m_constants[0], dataSize);
+}
+
 IE_SUPPRESS_DEPRECATED_START
 std::vector<IVariableStateInternal::Ptr> MKLDNNExecNetwork::QueryState() {
     return memoryStates;
@@ -13,6 +13,8 @@
 #include <vector>
 #include <memory>
 #include <map>
+#include <list>
+#include <functional>
 #include <string>
 #include <legacy/cnn_network_impl.hpp>
 #include <unordered_map>
@@ -22,6 +24,9 @@ namespace MKLDNNPlugin {
 class MKLDNNExecNetwork: public InferenceEngine::ExecutableNetworkThreadSafeDefault {
 public:
     typedef std::shared_ptr<MKLDNNExecNetwork> Ptr;
+    // Converts an nGraph network to the legacy representation consumed by MKLDNNGraph in place
+    using NetworkTransformer = std::function<void(InferenceEngine::CNNNetwork&)>;
+    using InputShapes = std::map<std::string, InferenceEngine::SizeVector>;
 
     InferenceEngine::InferRequestInternal::Ptr
     CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
@@ -30,7 +35,9 @@ public:
     InferenceEngine::IInferRequest::Ptr CreateInferRequest() override;
 
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const InferenceEngine::CNNNetwork &sourceNetwork = {},
+                      const NetworkTransformer &transformNetwork = {});
 
     ~MKLDNNExecNetwork() override = default;
 
@@ -42,6 +49,14 @@ public:
 
     InferenceEngine::CNNNetwork GetExecGraphInfo() override;
 
+    void ExportImpl(std::ostream& networkModel) override;
+
+    /**
+     * Checks if the transformed legacy network can be exported, so its import skips the transformations.
+     * Bodies of TensorIterator layers and outputs of layers with consumers can't be serialized to the legacy IR.
+     */
+    static bool CanExportLegacyNetwork(const InferenceEngine::CNNNetwork& network);
+
     INFERENCE_ENGINE_DEPRECATED("Use InferRequest::QueryState instead")
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
@@ -50,10 +65,20 @@ protected:
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
     InferenceEngine::CNNNetwork                 _clonedNetwork;
+    // Copy of the nGraph network passed to LoadNetwork. It is kept only when the shape cache compiles graphs
+    // from it or the legacy network can't be exported, then ExportImpl serializes it instead
+    InferenceEngine::CNNNetwork                 _sourceNetwork;
     std::mutex                                  _cfgMutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
+    // Total size of intermediate tensors workspaces of stream graphs and input/output arenas of infer requests
+    MKLDNNArenaStatistics::Ptr                  _arenaStatistics = std::make_shared<MKLDNNArenaStatistics>();
     std::string                                 _name;
+    // NUMA nodes the infer requests are spread over, empty unless the streams are bound to several nodes
+    std::vector<int>                            _numaNodes;
+    // starts the pipeline tasks of a request on the streams of the request node, one executor per node
+    std::vector<InferenceEngine::ITaskExecutor::Ptr> _numaNodeExecutors;
+    std::atomic<std::size_t>                    _nextNumaNode = {0};
     struct Graph : public MKLDNNGraph {
         std::mutex  _mutex;
         struct Lock : public std::unique_lock<std::mutex> {
@@ -65,12 +90,41 @@ protected:
     std::deque<Graph>                           _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
 
+    // Stream graphs compiled from the source network reshaped to other input shapes
+    struct ShapeGraphs {
+        InferenceEngine::CNNNetwork             _network;
+        std::deque<Graph>                       _graphs;
+    };
+    NetworkTransformer                          _transformNetwork;
+    InputShapes                                 _inputShapes;
+    bool                                        _canSwitchShapes = false;
+    std::size_t                                 _shapeCacheCapacity = 0;
+    std::mutex                                  _shapeGraphsMutex;
+    // the most recently used shapes are at the front
+    std::list<std::pair<InputShapes, std::shared_ptr<ShapeGraphs>>> _shapeGraphs;
+
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
      *       even from main thread
      */
     Graph::Lock GetGraph();
 
+    /* Returns the graph of current stream compiled for the input shapes, the loaded network graph is returned
+     * for its own shapes. `owner` keeps the graphs alive after they are evicted from the cache
+     */
+    Graph::Lock GetGraph(const InputShapes& shapes, std::shared_ptr<ShapeGraphs>& owner);
+
+    Graph::Lock GetGraph(std::deque<Graph>& graphs, const InferenceEngine::CNNNetwork& network);
+
+    std::shared_ptr<ShapeGraphs> GetShapeGraphs(const InputShapes& shapes);
+
+    /* Runs the task on a stream of the NUMA node and waits for it, so the memory first touched by the task
+     * is placed on the node. The task is run in place by the streams of the node or if the nodes are not used
+     */
+    void RunOnNumaNode(int numaNodeId, const InferenceEngine::Task& task);
+
+    void PrepareNetwork(InferenceEngine::CNNNetwork& network, const Config& cfg);
+
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 };
 
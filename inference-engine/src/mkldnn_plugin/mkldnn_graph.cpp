@@ -13,6 +13,11 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <set>
+#include <mutex>
+#include <exception>
+#include <functional>
+#include <cstring>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -35,10 +40,15 @@
 
 #include "precision_utils.h"
 #include <ie_plugin_config.hpp>
+#include <ie_parallel.hpp>
 
 #include "utils/blob_dump.h"
 #include "utils/general_utils.h"
 
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+#include <tbb/task_group.h>
+#endif
+
 /*****************************************************
  * Debug capability
  *  - BLOB_DUMP_PATH : Specify with existing folder name
@@ -101,8 +111,8 @@ void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr&
 
     if (IsReady())
         ForgetGraphData();
-    // disable caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // the cache is shared by all networks loaded to the plugin, so it is used even for a single stream
+    weightsCache = w_cache;
 
     Replicate(net, extMgr);
     InitGraph();
@@ -381,6 +391,8 @@ void MKLDNNGraph::InitGraph() {
 #endif
 
     ExecuteConstantNodesOnly();
+
+    InitExecutionDependencies();
 }
 
 void MKLDNNGraph::SetOriginalLayerNames() {
@@ -463,7 +475,7 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() {
             auto edgePtr = graphNode->getChildEdgeAt(i);
             if (edgePtr) {
                 if (edgePtr->isUseExternalMemory()) {
-                    auto ptr = weightsCache->get(edgePtr->name());
+                    auto ptr = weightsCache->get(edgePtr->externalMemoryKey);
                     outputs.emplace_back(ptr);
                     if (!ptr->isValid())
                         hasExternalInvalidEdges = true;
@@ -615,8 +627,51 @@ static edge_clusters_t findEdgeClusters(const std::vector<MKLDNNEdgePtr> & graph
     return edge_clusters;
 }
 
+// Hash of the data produced by a constant node. It covers the node itself, its parameters and constant data
+// of all nodes it depends on, so equal constant subgraphs of different networks have equal hashes
+static uint64_t constantDataHash(const MKLDNNNodePtr& node, std::unordered_map<MKLDNNNode*, uint64_t>& hashes) {
+    auto found = hashes.find(node.get());
+    if (found != hashes.end())
+        return found->second;
+
+    const auto& crc = MKLDNNWeightsSharing::GetHashFunc();
+    auto hashString = [&](const std::string& str) {
+        return crc.hash(reinterpret_cast<const unsigned char*>(str.data()), str.size());
+    };
+    auto combine = [](uint64_t seed, uint64_t value) {
+        return seed ^ (value + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2));
+    };
+
+    uint64_t hash = hashString(node->getTypeStr() + ":" + node->getName());
+    if (const auto& layer = node->getCnnLayer()) {
+        for (const auto& param : layer->params)
+            hash = combine(hash, hashString(param.first + "=" + param.second));
+        for (const auto& blob : layer->blobs) {
+            if (blob.second) {
+                hash = combine(hash, blob.second->byteSize());
+                hash = combine(hash, crc.hash(blob.second->cbuffer().as<const unsigned char*>(), blob.second->byteSize()));
+            }
+        }
+    }
+    if (auto input = dynamic_cast<MKLDNNInputNode*>(node.get())) {
+        if (input->constBlob) {
+            hash = combine(hash, input->constBlob->byteSize());
+            hash = combine(hash, crc.hash(input->constBlob->cbuffer().as<const unsigned char*>(), input->constBlob->byteSize()));
+        }
+    }
+    for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+        auto parentEdge = node->getParentEdgeAt(i);
+        hash = combine(hash, constantDataHash(parentEdge->getParent(), hashes));
+        hash = combine(hash, static_cast<uint64_t>(parentEdge->getInputNum()));
+    }
+
+    hashes[node.get()] = hash;
+    return hash;
+}
+
 void MKLDNNGraph::AllocateWithReuse() {
     edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
+    std::unordered_map<MKLDNNNode*, uint64_t> constantHashes;
 
     size_t edge_clusters_count = edge_clusters.size();
 
@@ -626,7 +681,17 @@ void MKLDNNGraph::AllocateWithReuse() {
         for (auto &edge : cluster) {
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation
                 && edge->getParent()->isConstant()) {
-                edge->externalAllocate(weightsCache);
+                std::string key;
+                if (weightsCache) {
+                    auto dataHash = constantDataHash(edge->getParent(), constantHashes);
+                    MKLDNNMemoryDesc desc(edge->getDesc());
+                    // edge name keeps keys of edges from the same port different, every edge is filled separately.
+                    // The data is produced only on execution, so unlike weights it cannot be compared on a hit,
+                    // the hash covers names, parameters, sizes and content of the whole constant subgraph instead
+                    key = edge->name() + "_" + MKLDNNWeightsSharing::GetContentKey(dataHash,
+                            static_cast<mkldnn::memory::desc>(desc).get_size(), desc);
+                }
+                edge->externalAllocate(weightsCache, key);
                 erase = true;
             }
         }
@@ -696,17 +761,30 @@ void MKLDNNGraph::AllocateWithReuse() {
         box.size = div_up(box.size, alignment);
     }
 
-    MemorySolver memSolver(boxes);
+    MemorySolver memSolver(boxes, config.memorySolverStrategy);
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    memWorkspaceSize = total_size;
+    memWorkspaceLowerBound = static_cast<size_t>(memSolver.maxDepth()) * alignment;
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
     memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+    memWorkspaceGuard.reset(new MKLDNNArenaStatistics::Guard(arenaStatistics, total_size));
+
+    // The pages are placed on the NUMA node of the thread touching them first. The graph is built by its stream,
+    // so the workspace is touched by the threads of the stream and lands on the node the stream is bound to
+    auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
+    if (firstTouchWorkspace) {
+        InferenceEngine::parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            InferenceEngine::splitter(total_size, nthr, ithr, start, end);
+            if (start < end)
+                std::memset(workspace_ptr + start, 0, end - start);
+        });
+    }
 
     if (edge_clusters.empty())
         return;
 
-    auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
-
     for (int i = 0; i < edge_clusters.size(); i++) {
         int count = 0;
         for (auto &edge : edge_clusters[i]) {
@@ -837,11 +915,112 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
     }
 }
 
+void MKLDNNGraph::InitExecutionDependencies() {
+    executableNodes.clear();
+    executableNodeSuccessors.clear();
+    executableNodePredecessorsCount.clear();
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (!config.interOpParallel)
+        return;
+
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::InitExecutionDependencies");
+
+    std::vector<MKLDNNNodePtr> nodes;
+    std::unordered_map<const MKLDNNNode*, size_t> nodeIndices;
+    for (auto &node : graphNodes) {
+        if (!node->isConstant()) {
+            nodeIndices.emplace(node.get(), nodes.size());
+            nodes.push_back(node);
+        }
+    }
+
+    // Dependencies always follow the sequential execution order, so the result is acyclic
+    std::vector<std::set<size_t>> successors(nodes.size());
+    auto addDependency = [&](size_t lhs, size_t rhs) {
+        if (lhs != rhs)
+            successors[std::min(lhs, rhs)].insert(std::max(lhs, rhs));
+    };
+
+    // Edges sharing memory because of in-place optimizations or reuse decided by MemorySolver
+    // are found by memory overlapping, so such nodes keep their sequential order
+    struct MemoryAccess {
+        const uint8_t* begin;
+        const uint8_t* end;
+        size_t node;
+        bool write;
+    };
+    std::vector<MemoryAccess> accesses;
+    for (auto &edge : graphEdges) {
+        auto parent = nodeIndices.find(edge->getParent().get());
+        auto child = nodeIndices.find(edge->getChild().get());
+        if (parent != nodeIndices.end() && child != nodeIndices.end())
+            addDependency(parent->second, child->second);
+
+        const auto &memory = edge->getMemory();
+        auto begin = static_cast<const uint8_t*>(memory.GetData());
+        if (begin == nullptr)
+            continue;
+        auto end = static_cast<const uint8_t*>(memory.GetPtr()) + memory.GetDescriptor().get_size();
+        if (parent != nodeIndices.end())
+            accesses.push_back({begin, end, parent->second, true});
+        if (child != nodeIndices.end())
+            accesses.push_back({begin, end, child->second, false});
+    }
+
+    std::sort(accesses.begin(), accesses.end(), [](const MemoryAccess& lhs, const MemoryAccess& rhs) {
+        return lhs.begin < rhs.begin;
+    });
+    for (size_t i = 0; i < accesses.size(); i++) {
+        for (size_t j = i + 1; j < accesses.size() && accesses[j].begin < accesses[i].end; j++) {
+            if (accesses[i].write || accesses[j].write)
+                addDependency(accesses[i].node, accesses[j].node);
+        }
+    }
+
+    // Memory nodes communicate through the state storage which is not represented by edges
+    size_t lastMemoryNode = nodes.size();
+    for (size_t i = 0; i < nodes.size(); i++) {
+        if (nodes[i]->getType() == MemoryInput || nodes[i]->getType() == MemoryOutput) {
+            if (lastMemoryNode != nodes.size())
+                addDependency(lastMemoryNode, i);
+            lastMemoryNode = i;
+        }
+    }
+
+    // There is nothing to execute in parallel if each node depends on the previous one
+    bool hasIndependentNodes = false;
+    for (size_t i = 0; i + 1 < nodes.size() && !hasIndependentNodes; i++) {
+        hasIndependentNodes = successors[i].count(i + 1) == 0;
+    }
+    if (!hasIndependentNodes)
+        return;
+
+    executableNodes = std::move(nodes);
+    executableNodeSuccessors.resize(executableNodes.size());
+    executableNodePredecessorsCount.resize(executableNodes.size(), 0);
+    for (size_t i = 0; i < successors.size(); i++) {
+        executableNodeSuccessors[i].assign(successors[i].begin(), successors[i].end());
+        for (auto successor : successors[i])
+            executableNodePredecessorsCount[successor]++;
+    }
+#endif
+}
+
 void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
     if (!IsReady()) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
+    if (executableNodes.empty())
+        InferSequential(request, batch);
+    else
+        InferParallel(request, batch);
+
+    if (infer_count != -1) infer_count++;
+}
+
+void MKLDNNGraph::InferSequential(MKLDNNInferRequest* request, int batch) {
     mkldnn::stream stream(eng);
 
     for (int i = 0; i < graphNodes.size(); i++) {
@@ -862,8 +1041,92 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
         }
         ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
     }
+}
 
-    if (infer_count != -1) infer_count++;
+void MKLDNNGraph::InferParallel(MKLDNNInferRequest* request, int batch) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (batch > 0) {
+        for (auto &node : graphNodes) {
+            if (node->isConstant())
+                node->setDynamicBatchLim(batch);
+        }
+    }
+
+    const size_t nodesCount = executableNodes.size();
+    std::unique_ptr<std::atomic<size_t>[]> predecessorsCount{new std::atomic<size_t>[nodesCount]};
+    for (size_t i = 0; i < nodesCount; i++)
+        predecessorsCount[i] = executableNodePredecessorsCount[i];
+
+    std::atomic<bool> failed{false};
+    std::exception_ptr exception;
+    std::mutex exceptionMutex;
+    tbb::task_group taskGroup;
+
+    std::function<void(size_t)> executeFrom = [&](size_t idx) {
+        while (!failed) {
+            const auto &node = executableNodes[idx];
+            try {
+                if (request != nullptr) {
+                    request->ThrowIfCanceled();
+                }
+
+                PERF(node);
+
+                if (batch > 0)
+                    node->setDynamicBatchLim(batch);
+
+                ENABLE_DUMP(do_before(DUMP_DIR, node));
+                {
+                    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
+                    mkldnn::stream stream(eng);
+                    // A thread waiting inside of the node parallel region must not pick up other nodes,
+                    // as they would share thread local resources (e.g. scratchpad) with the interrupted one
+                    tbb::this_task_arena::isolate([&] {
+                        node->execute(stream);
+                    });
+                }
+                ENABLE_DUMP(do_after(DUMP_DIR, node));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock{exceptionMutex};
+                if (!exception)
+                    exception = std::current_exception();
+                failed = true;
+                return;
+            }
+
+            // Continue with one of the ready successors in the current task and spawn the others
+            size_t next = nodesCount;
+            for (auto successor : executableNodeSuccessors[idx]) {
+                if (--predecessorsCount[successor] == 0) {
+                    if (next == nodesCount) {
+                        next = successor;
+                    } else {
+                        taskGroup.run([&executeFrom, successor] {
+                            executeFrom(successor);
+                        });
+                    }
+                }
+            }
+            if (next == nodesCount)
+                return;
+            idx = next;
+        }
+    };
+
+    for (size_t i = 0; i < nodesCount; i++) {
+        if (executableNodePredecessorsCount[i] == 0) {
+            taskGroup.run([&executeFrom, i] {
+                executeFrom(i);
+            });
+        }
+    }
+    taskGroup.wait();
+
+    if (exception)
+        std::rethrow_exception(exception);
+#else
+    InferSequential(request, batch);
+#endif
 }
 
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
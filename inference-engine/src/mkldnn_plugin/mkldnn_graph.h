@@ -11,6 +11,7 @@
 #include "mean_image.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "mkldnn_arena.h"
 #include "threading/ie_thread_local.hpp"
 #include <map>
 #include <string>
@@ -24,6 +25,10 @@ class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
     MKLDNNWeightsSharing::Ptr weightsCache;
+    // Accounts the intermediate tensors workspace in the memory arenas of the executable network
+    MKLDNNArenaStatistics::Ptr arenaStatistics;
+    // Zeroes the workspace right after allocation, so its pages land on the NUMA node of the stream building the graph
+    bool firstTouchWorkspace = false;
 
     enum Status {
         NotReady = 0,
@@ -44,6 +49,14 @@ public:
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
+    size_t getWorkspaceSize() const {
+        return memWorkspaceSize;
+    }
+
+    size_t getWorkspaceLowerBound() const {
+        return memWorkspaceLowerBound;
+    }
+
     void getInputBlobs(InferenceEngine::BlobMap &in_map);
     void getOutputBlobs(InferenceEngine::BlobMap &out_map);
 
@@ -171,6 +184,9 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _meanImages.clear();
+        executableNodes.clear();
+        executableNodeSuccessors.clear();
+        executableNodePredecessorsCount.clear();
     }
     Status status { NotReady };
     Config config;
@@ -182,6 +198,10 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    std::unique_ptr<MKLDNNArenaStatistics::Guard> memWorkspaceGuard;
+    // Size of the workspace found by the memory solver and the lower bound of it
+    size_t memWorkspaceSize = 0;
+    size_t memWorkspaceLowerBound = 0;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
@@ -191,6 +211,12 @@ protected:
     std::map<std::string, MeanImage> _meanImages;
     std::string _name;
 
+    // Non constant nodes in execution order and dependencies between them.
+    // Filled only if independent branches of the graph are executed in parallel.
+    std::vector<MKLDNNNodePtr> executableNodes;
+    std::vector<std::vector<size_t>> executableNodeSuccessors;
+    std::vector<size_t> executableNodePredecessorsCount;
+
     static mkldnn::engine eng;
 
     void Replicate(const InferenceEngine::CNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
@@ -205,6 +231,9 @@ protected:
     void CreatePrimitives();
     void ExecuteConstantNodesOnly();
     void SetOriginalLayerNames();
+    void InitExecutionDependencies();
+    void InferSequential(MKLDNNInferRequest* request, int batch);
+    void InferParallel(MKLDNNInferRequest* request, int batch);
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
@@ -4,9 +4,11 @@
 
 #include "mkldnn_infer_request.h"
 #include "mkldnn_extension_utils.h"
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <map>
+#include <utility>
 #include <blob_factory.hpp>
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
@@ -22,7 +24,8 @@
 
 MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsDataMap     networkInputs,
                                                      InferenceEngine::OutputsDataMap    networkOutputs,
-                                                     MKLDNNExecNetwork::Ptr             execNetwork_)
+                                                     MKLDNNExecNetwork::Ptr             execNetwork_,
+                                                     int                                numaNodeId)
 : InferRequestInternal(networkInputs, networkOutputs)
 , execNetwork(execNetwork_) {
     auto id = (execNetwork->_numRequests)++;
@@ -31,10 +34,21 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
     if (execNetwork->_graphs.size() == 0)
         THROW_IE_EXCEPTION << "No graph was found";
     graph = &(execNetwork->GetGraph()._graph);
+    if (!graph->IsReady())
+        THROW_IE_EXCEPTION << "Graph is not ready!";
+
+    if (numaNodeId >= 0) {
+        // the blobs are allocated by a stream of the request NUMA node, so they are placed on the node
+        execNetwork->RunOnNumaNode(numaNodeId, [this] {
+            AllocateDefaultBlobs();
+        });
+    } else {
+        AllocateDefaultBlobs();
+    }
+    // Checks the allocated blobs and throws for names unknown to the graph
     for (const auto& it : _networkInputs) {
         MKLDNNInferRequest::GetBlob(it.first);
     }
-    // Allocate all output blobs
     for (const auto& it : _networkOutputs) {
         MKLDNNInferRequest::GetBlob(it.first);
     }
@@ -77,9 +91,14 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
 
     InferenceEngine::Blob::Ptr iconv;
     if (needConvert) {
-        iconv = make_blob_with_precision(inPrec, InferenceEngine::TensorDesc(inPrec, inputBlob->getTensorDesc().getDims(),
-                                         inputBlob->getTensorDesc().getLayout()));
-        iconv->allocate();
+        // The converted blob is kept between infer calls to avoid an allocation per inference
+        InferenceEngine::TensorDesc iconvDesc(inPrec, inputBlob->getTensorDesc().getDims(), inputBlob->getTensorDesc().getLayout());
+        auto& cached = convertedInputs[inputName];
+        if (!cached || cached->getTensorDesc() != iconvDesc) {
+            cached = make_blob_with_precision(inPrec, iconvDesc);
+            cached->allocate();
+        }
+        iconv = cached;
         if (inputBlob->size() != iconv->size())
             THROW_IE_EXCEPTION << "Can't copy tensor: input and converted tensors have different number of elements: " << inputBlob->size() << " and "
                                << iconv->size();
@@ -182,11 +201,19 @@ void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
-    auto graphLock = execNetwork->GetGraph();
+    MKLDNNExecNetwork::InputShapes shapes;
+    if (execNetwork->_canSwitchShapes) {
+        shapes = getInputShapes();
+    }
+    auto graphLock = execNetwork->_canSwitchShapes ? execNetwork->GetGraph(shapes, shapeGraphs) : execNetwork->GetGraph();
     graph = &(graphLock._graph);
 
     ThrowIfCanceled();
 
+    if (execNetwork->_canSwitchShapes) {
+        updateDefaultOutputs(shapes);
+    }
+
     execDataPreprocessing(_inputs);
 
     changeDefaultPtr();
@@ -218,6 +245,149 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MKLDNNPlugin:
     return perfMap;
 }
 
+InferenceEngine::TensorDesc MKLDNNPlugin::MKLDNNInferRequest::getDefaultInputDesc(const std::string& name,
+                                                                                  const InferenceEngine::TensorDesc& graphDesc) {
+    auto input = _networkInputs.find(name);
+    if (input == _networkInputs.end())
+        return graphDesc;
+
+    return InferenceEngine::TensorDesc(input->second->getPrecision(),
+                                       input->second->getTensorDesc().getDims(),
+                                       input->second->getLayout());
+}
+
+InferenceEngine::TensorDesc MKLDNNPlugin::MKLDNNInferRequest::getDefaultOutputDesc(const InferenceEngine::TensorDesc& graphDesc) {
+    // WA: need to avoid exception thrown when we compare blocking desc in SetBlob
+    // in situation if we push output blobs as inputs for next network (in Hetero plugin)
+    // it may be that output tensor desc will be different from real input tensor desc for next network
+    // because the optimal descriptor was chosen (e.g. inPlace case for Split node)
+    auto currBlockDesc = InferenceEngine::BlockingDesc(graphDesc.getBlockingDesc().getBlockDims(), graphDesc.getBlockingDesc().getOrder());
+    return InferenceEngine::TensorDesc(graphDesc.getPrecision(), graphDesc.getDims(), currBlockDesc);
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::setDefaultInput(const std::string& name, const InferenceEngine::Blob::Ptr& blob,
+                                                       InferenceEngine::Precision originPrecision) {
+    _inputs[name] = blob;
+    if (blob->getTensorDesc().getPrecision() == originPrecision &&
+            graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+        externalPtr[name] = blob->buffer();
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::setDefaultOutput(const std::string& name, const InferenceEngine::Blob::Ptr& blob) {
+    _outputs[name] = blob;
+    userOutputs.erase(name);
+    if (blob->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 && !graph->getProperty().batchLimit) {
+        externalPtr[name] = blob->buffer();
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::AllocateDefaultBlobs() {
+    // All default input and output blobs of the request are placed into a single arena,
+    // so the request performs one allocation instead of one per blob
+    InferenceEngine::BlobMap graphInputs, graphOutputs;
+    graph->getInputBlobs(graphInputs);
+    graph->getOutputBlobs(graphOutputs);
+
+    MKLDNNArena arena(execNetwork->_arenaStatistics);
+    std::vector<std::pair<std::string, size_t>> inputs, outputs;
+    for (const auto& it : _networkInputs) {
+        auto graphInput = graphInputs.find(it.first);
+        if (graphInput != graphInputs.end())
+            inputs.emplace_back(it.first, arena.reserve(getDefaultInputDesc(it.first, graphInput->second->getTensorDesc())));
+    }
+    for (const auto& it : _networkOutputs) {
+        auto graphOutput = graphOutputs.find(it.first);
+        if (graphOutput != graphOutputs.end() && graphInputs.find(it.first) == graphInputs.end())
+            outputs.emplace_back(it.first, arena.reserve(getDefaultOutputDesc(graphOutput->second->getTensorDesc())));
+    }
+    arena.allocate(!execNetwork->_numaNodes.empty());
+
+    for (const auto& input : inputs) {
+        setDefaultInput(input.first, arena.getBlob(input.second), graphInputs[input.first]->getTensorDesc().getPrecision());
+    }
+    for (const auto& output : outputs) {
+        setDefaultOutput(output.first, arena.getBlob(output.second));
+    }
+}
+
+MKLDNNPlugin::MKLDNNExecNetwork::InputShapes MKLDNNPlugin::MKLDNNInferRequest::getInputShapes() const {
+    MKLDNNExecNetwork::InputShapes shapes;
+    for (const auto& input : _networkInputs) {
+        auto blob = _inputs.find(input.first);
+        if (blob != _inputs.end() && blob->second) {
+            shapes[input.first] = blob->second->getTensorDesc().getDims();
+        } else {
+            shapes[input.first] = input.second->getTensorDesc().getDims();
+        }
+    }
+    return shapes;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::updateDefaultOutputs(const MKLDNNExecNetwork::InputShapes& shapes) {
+    // The default outputs of the recently used shapes are kept as long as their graphs may be cached,
+    // so switching between the shapes doesn't allocate the outputs again
+    auto found = std::find_if(shapeOutputs.begin(), shapeOutputs.end(),
+                              [&](const std::pair<MKLDNNExecNetwork::InputShapes, InferenceEngine::BlobMap>& entry) {
+                                  return entry.first == shapes;
+                              });
+    if (found == shapeOutputs.end()) {
+        shapeOutputs.emplace_front(shapes, InferenceEngine::BlobMap{});
+        // the graphs of the loaded shapes are never evicted
+        if (shapeOutputs.size() > execNetwork->_shapeCacheCapacity + 1)
+            shapeOutputs.pop_back();
+    } else {
+        shapeOutputs.splice(shapeOutputs.begin(), shapeOutputs, found);
+    }
+    auto& defaultOutputs = shapeOutputs.front().second;
+
+    InferenceEngine::BlobMap graphOutputs;
+    graph->getOutputBlobs(graphOutputs);
+    for (const auto& it : graphOutputs) {
+        const auto& dims = it.second->getTensorDesc().getDims();
+        auto output = _outputs.find(it.first);
+        // blobs set by the user are never replaced
+        if (userOutputs.count(it.first)) {
+            if (output->second->getTensorDesc().getDims() != dims) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to infer with output blob '" << it.first
+                                   << "'. Dimensions mismatch with the output for the input shapes.";
+            }
+            continue;
+        }
+        auto& blob = defaultOutputs[it.first];
+        if (!blob) {
+            if (output != _outputs.end() && output->second->getTensorDesc().getDims() == dims) {
+                blob = output->second;
+            } else {
+                blob = make_blob_with_precision(getDefaultOutputDesc(it.second->getTensorDesc()));
+                blob->allocate();
+            }
+        }
+        if (output == _outputs.end() || output->second != blob) {
+            externalPtr.erase(it.first);
+            setDefaultOutput(it.first, blob);
+        }
+    }
+}
+
+InferenceEngine::SizeVector MKLDNNPlugin::MKLDNNInferRequest::refDims(const InferenceEngine::Blob::Ptr& blob) const {
+    // blobs of other shapes are valid when the executable network compiles graphs for them
+    return execNetwork->_canSwitchShapes ? blob->getTensorDesc().getDims() : InferenceEngine::SizeVector{};
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::checkBlobs() {
+    if (!execNetwork->_canSwitchShapes) {
+        InferRequestInternal::checkBlobs();
+        return;
+    }
+    for (auto const& input : _inputs) {
+        checkBlob(input.second, input.first, true, refDims(input.second));
+    }
+    for (auto const& output : _outputs) {
+        checkBlob(output.second, output.first, false, refDims(output.second));
+    }
+}
+
 InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::string& name) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "GetBlob");
 
@@ -239,27 +409,13 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
 
         if (_inputs.find(name) != _inputs.end()) {
             data = _inputs[name];
-            checkBlob(data, name, true);
+            checkBlob(data, name, true, refDims(data));
             return data;
         }
 
-        InferenceEngine::TensorDesc desc = blobs[name]->getTensorDesc();
-        InferenceEngine::Precision originPrecision = blobs[name]->getTensorDesc().getPrecision();
-        if (_networkInputs.find(name) != _networkInputs.end()) {
-            InferenceEngine::Layout l = _networkInputs[name]->getLayout();
-            InferenceEngine::Precision p = _networkInputs[name]->getPrecision();
-            InferenceEngine::SizeVector dims = _networkInputs[name]->getTensorDesc().getDims();
-
-            desc = InferenceEngine::TensorDesc(p, dims, l);
-        }
-
-        _inputs[name] = make_blob_with_precision(desc);
-        _inputs[name]->allocate();
-        if (desc.getPrecision() == originPrecision &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
-            externalPtr[name] = _inputs[name]->buffer();
-        }
-        data = _inputs[name];
+        data = make_blob_with_precision(getDefaultInputDesc(name, blobs[name]->getTensorDesc()));
+        data->allocate();
+        setDefaultInput(name, data, blobs[name]->getTensorDesc().getPrecision());
         checkBlob(data, name, true);
         return data;
     }
@@ -268,25 +424,13 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
     if (blobs.find(name) != blobs.end()) {
         if (_outputs.find(name) != _outputs.end()) {
             data = _outputs[name];
-            checkBlob(data, name, false);
+            checkBlob(data, name, false, refDims(data));
             return data;
         }
 
-        InferenceEngine::TensorDesc desc = blobs[name]->getTensorDesc();
-
-        // WA: need to avoid exception thrown when we compare blocking desc in SetBlob
-        // in situation if we push output blobs as inputs for next network (in Hetero plugin)
-        // it may be that output tensor desc will be different from real input tensor desc for next network
-        // because the optimal descriptor was chosen (e.g. inPlace case for Split node)
-        auto currBlockDesc = InferenceEngine::BlockingDesc(desc.getBlockingDesc().getBlockDims(), desc.getBlockingDesc().getOrder());
-        desc = InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), currBlockDesc);
-
-        _outputs[name] = make_blob_with_precision(desc);
-        _outputs[name]->allocate();
-        if (desc.getPrecision() == InferenceEngine::Precision::FP32 && !graph->getProperty().batchLimit) {
-            externalPtr[name] = _outputs[name]->buffer();
-        }
-        data = _outputs[name];
+        data = make_blob_with_precision(getDefaultOutputDesc(blobs[name]->getTensorDesc()));
+        data->allocate();
+        setDefaultOutput(name, data);
         checkBlob(data, name, false);
         return data;
     }
@@ -332,21 +476,37 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             // pre-processing
             _preProcData[name]->setRoiBlob(data);
         } else {
-            size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-                ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
-                : 1;
-            if (dataSize != inputSize) {
-                THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
-                                   << dataSize << "!=" << inputSize << ").";
-            }
+            const auto& inputDesc = foundInput->getTensorDesc();
+            const auto& dataDesc = data->getTensorDesc();
+            if (!execNetwork->_canSwitchShapes || inputDesc.getDims() == dataDesc.getDims()) {
+                size_t inputSize = inputDesc.getLayout() != InferenceEngine::Layout::SCALAR
+                    ? InferenceEngine::details::product(inputDesc.getDims())
+                    : 1;
+                if (dataSize != inputSize) {
+                    THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
+                                       << dataSize << "!=" << inputSize << ").";
+                }
 
-            if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Dimensions mismatch.";
-            }
+                if (inputDesc.getDims() != dataDesc.getDims()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Dimensions mismatch.";
+                }
+
+                if (dataDesc.getLayout() != InferenceEngine::Layout::ANY && inputDesc.getLayout() != InferenceEngine::Layout::ANY &&
+                    inputDesc.getBlockingDesc() != dataDesc.getBlockingDesc()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Blocking descriptor mismatch.";
+                }
+            } else {
+                // the blob selects the graph compiled for its dims on the next inference, so only the rank and
+                // the layout have to match the network input
+                if (inputDesc.getDims().size() != dataDesc.getDims().size()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Rank mismatch ("
+                                       << dataDesc.getDims().size() << "!=" << inputDesc.getDims().size() << ").";
+                }
 
-            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-                foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
-                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Blocking descriptor mismatch.";
+                if (dataDesc.getLayout() != InferenceEngine::Layout::ANY && inputDesc.getLayout() != InferenceEngine::Layout::ANY &&
+                    inputDesc.getLayout() != dataDesc.getLayout()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Layout mismatch.";
+                }
             }
 
             if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
@@ -366,19 +526,22 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output blob with precision: "
                                << data->getTensorDesc().getPrecision() << ", if CNNNetwork output blob precision is: " << foundOutput->getPrecision();
         }
-        size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-            ? InferenceEngine::details::product(foundOutput->getDims())
-            : 1;
-        if (dataSize != outputSize) {
-            THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
-                               << dataSize << "!=" << outputSize << ").";
-        }
-        if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output Blob. Dimensions mismatch.";
-        }
-        if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-            foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
-                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output blob. Blocking descriptor mismatch.";
+        // an output of other dims has to match the output of the graph for the shapes of inputs at inference
+        if (!execNetwork->_canSwitchShapes || foundOutput->getTensorDesc().getDims() == data->getTensorDesc().getDims()) {
+            size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
+                ? InferenceEngine::details::product(foundOutput->getDims())
+                : 1;
+            if (dataSize != outputSize) {
+                THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
+                                   << dataSize << "!=" << outputSize << ").";
+            }
+            if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output Blob. Dimensions mismatch.";
+            }
+            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output blob. Blocking descriptor mismatch.";
+            }
         }
         if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
                 !graph->getProperty().batchLimit) {
@@ -387,6 +550,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             externalPtr.erase(name);
         }
         _outputs[name] = data;
+        userOutputs.insert(name);
     }
 }
 
@@ -5,14 +5,18 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include "mkldnn_arena.h"
+#include "mkldnn_exec_network.h"
+#include <list>
 #include <memory>
 #include <string>
 #include <map>
+#include <unordered_set>
+#include <utility>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
 
-class MKLDNNExecNetwork;
 class MKLDNNAsyncInferRequest;
 
 class MKLDNNInferRequest : public InferenceEngine::InferRequestInternal {
@@ -20,7 +24,8 @@ public:
     typedef std::shared_ptr<MKLDNNInferRequest> Ptr;
     explicit MKLDNNInferRequest(InferenceEngine::InputsDataMap      networkInputs,
                                 InferenceEngine::OutputsDataMap     networkOutputs,
-                                std::shared_ptr<MKLDNNExecNetwork>  execNetwork);
+                                std::shared_ptr<MKLDNNExecNetwork>  execNetwork,
+                                int                                 numaNodeId = -1);
 
     ~MKLDNNInferRequest() override;
 
@@ -34,6 +39,8 @@ public:
 
     void SetBatch(int batch = -1) override;
 
+    void checkBlobs() override;
+
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
     /**
@@ -55,9 +62,26 @@ private:
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
     void changeDefaultPtr();
+
+    InferenceEngine::TensorDesc getDefaultInputDesc(const std::string& name, const InferenceEngine::TensorDesc& graphDesc);
+    InferenceEngine::TensorDesc getDefaultOutputDesc(const InferenceEngine::TensorDesc& graphDesc);
+    void setDefaultInput(const std::string& name, const InferenceEngine::Blob::Ptr& blob, InferenceEngine::Precision originPrecision);
+    void setDefaultOutput(const std::string& name, const InferenceEngine::Blob::Ptr& blob);
+    void AllocateDefaultBlobs();
+    MKLDNNExecNetwork::InputShapes getInputShapes() const;
+    void updateDefaultOutputs(const MKLDNNExecNetwork::InputShapes& shapes);
+    InferenceEngine::SizeVector refDims(const InferenceEngine::Blob::Ptr& blob) const;
+
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
+    // keeps the graphs of the last used input shapes alive while they are referenced by `graph`
+    std::shared_ptr<MKLDNNExecNetwork::ShapeGraphs> shapeGraphs;
+    // default outputs allocated for the recently used input shapes, the most recently used are at the front
+    std::list<std::pair<MKLDNNExecNetwork::InputShapes, InferenceEngine::BlobMap>> shapeOutputs;
+    // outputs set by SetBlob, they are not replaced by default blobs
+    std::unordered_set<std::string>     userOutputs;
     std::map<std::string, void*>        externalPtr;
+    InferenceEngine::BlobMap            convertedInputs;
     openvino::itt::handle_t             profilingTask;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
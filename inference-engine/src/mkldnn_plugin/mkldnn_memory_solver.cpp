@@ -7,12 +7,15 @@
 #include <details/ie_exception.hpp>
 
 #include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
 #include <vector>
 #include <map>
 
 namespace MKLDNNPlugin {
 
-MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
+MemorySolver::MemorySolver(const std::vector<Box>& boxes, Strategy strategy) : _boxes(boxes), _strategy(strategy) {
     int max_ts = 0;
     // TODO: add validation of data correctness:
     // 1. Box.start >= 0 and Box.finish >= -1
@@ -58,17 +61,82 @@ inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Bo
 
 int64_t MemorySolver::solve() {
     maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
+
+    _offsets.clear();
+    int64_t min_required = solveGreedy(_offsets);
+    if (_strategy == Strategy::Greedy)
+        return min_required;
+
+    auto duration = [](const Box* box) { return box->finish - box->start + 1; };
+    std::vector<std::function<bool(const Box*, const Box*)>> orderings = {
+        // the biggest boxes first, the longest living ones among them
+        [&](const Box* l, const Box* r) {
+            return l->size > r->size || (l->size == r->size && duration(l) > duration(r));
+        },
+        // the longest living boxes first, the biggest ones among them
+        [&](const Box* l, const Box* r) {
+            return duration(l) > duration(r) || (duration(l) == duration(r) && l->size > r->size);
+        },
+        // boxes with the biggest area on the time-memory plane first
+        [&](const Box* l, const Box* r) {
+            return l->size * duration(l) > r->size * duration(r);
+        },
+        // boxes in execution order, so the freed memory is reused as soon as possible
+        [](const Box* l, const Box* r) {
+            return l->start < r->start || (l->start == r->start && l->size > r->size);
+        },
+    };
+
+    std::vector<const Box*> order;
+    for (const Box& box : _boxes) order.push_back(&box);
+
+    std::map<int64_t, int64_t> offsets;
+    for (const auto& ordering : orderings) {
+        std::stable_sort(order.begin(), order.end(), ordering);
+        offsets.clear();
+        auto required = solveBestFit(order, offsets);
+        if (required < min_required) {
+            min_required = required;
+            std::swap(_offsets, offsets);
+        }
+        // lower bound is reached, no better solution exists
+        if (min_required == _depth) break;
+    }
+
+    return min_required;
+}
+
+int64_t MemorySolver::maxDepth() {
+    if (_depth == -1) calcDepth();
+    return _depth;
+}
+
+int64_t MemorySolver::maxTopDepth() {
+    if (_top_depth == -1) calcDepth();
+    return _top_depth;
+}
+
+int64_t MemorySolver::getOffset(int id) const {
+    auto res = _offsets.find(id);
+    if (res == _offsets.end()) THROW_IE_EXCEPTION << "There are no box for provided ID";
+    return res->second;
+}
+
+//======== Private =============//
+
+int64_t MemorySolver::solveGreedy(std::map<int64_t, int64_t>& offsets) const {
+    std::vector<Box> boxes = _boxes;
     std::vector<std::vector<const Box*>> time_slots(_time_duration);
     for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
 
     // Sort be box size. First is biggest
     // Comment this line to check other order of box putting
-    std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r)
+    std::sort(boxes.begin(), boxes.end(), [](const Box& l, const Box& r)
         { return l.size > r.size; });
 
     int64_t _min_required = 0;
 
-    for (Box& box : _boxes) {
+    for (Box& box : boxes) {
         // start from bottom and will lift it up if intersect with other present
         int64_t id = box.id;
         box.id = 0;  // id will be used as a temp offset storage
@@ -90,30 +158,54 @@ int64_t MemorySolver::solve() {
 
         // store the max top bound for each box
         _min_required = std::max(_min_required, box.id + box.size);
-        _offsets[id] = box.id;  // TODO: move to constructor (use .insert instead of [])
+        offsets[id] = box.id;
     }
 
     return _min_required;
 }
 
-int64_t MemorySolver::maxDepth() {
-    if (_depth == -1) calcDepth();
-    return _depth;
-}
+int64_t MemorySolver::solveBestFit(const std::vector<const Box*>& order, std::map<int64_t, int64_t>& offsets) const {
+    struct Placed {
+        const Box* box;
+        int64_t offset;
+    };
+    std::vector<Placed> placed;
+    placed.reserve(order.size());
+    // [offset, offset + size) ranges of placed boxes intersecting the current one on the time axis
+    std::vector<std::pair<int64_t, int64_t>> busy;
+    busy.reserve(order.size());
+
+    int64_t min_required = 0;
+    for (const Box* box : order) {
+        busy.clear();
+        for (const auto& p : placed) {
+            if (p.box->start <= box->finish && box->start <= p.box->finish)
+                busy.emplace_back(p.offset, p.offset + p.box->size);
+        }
+        std::sort(busy.begin(), busy.end());
+
+        // look for the smallest gap between busy ranges the box fits to, or put it on top of them
+        int64_t best_offset = -1;
+        int64_t best_gap = std::numeric_limits<int64_t>::max();
+        int64_t free_from = 0;
+        for (const auto& range : busy) {
+            int64_t gap = range.first - free_from;
+            if (gap >= box->size && gap < best_gap) {
+                best_gap = gap;
+                best_offset = free_from;
+            }
+            free_from = std::max(free_from, range.second);
+        }
+        if (best_offset == -1) best_offset = free_from;
 
-int64_t MemorySolver::maxTopDepth() {
-    if (_top_depth == -1) calcDepth();
-    return _top_depth;
-}
+        placed.push_back({box, best_offset});
+        offsets[box->id] = best_offset;
+        min_required = std::max(min_required, best_offset + box->size);
+    }
 
-int64_t MemorySolver::getOffset(int id) const {
-    auto res = _offsets.find(id);
-    if (res == _offsets.end()) THROW_IE_EXCEPTION << "There are no box for provided ID";
-    return res->second;
+    return min_required;
 }
 
-//======== Private =============//
-
 void MemorySolver::calcDepth() {
     int64_t top_depth = 0;
     int64_t depth = 0;
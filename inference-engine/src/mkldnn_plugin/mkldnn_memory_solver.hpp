@@ -65,7 +65,18 @@ public:
         int64_t id;
     };
 
-    explicit MemorySolver(const std::vector<Box>& boxes);
+    /** @brief Strategy of box placement */
+    enum class Strategy {
+        /** Boxes are placed starting from the biggest one, each is lifted up above all intersecting boxes */
+        Greedy,
+        /**
+         * Several box orderings are tried, in each one a box is put into the tightest free gap between
+         * already placed intersecting boxes. The best result including the greedy one is taken.
+         */
+        BestFit,
+    };
+
+    explicit MemorySolver(const std::vector<Box>& boxes, Strategy strategy = Strategy::Greedy);
 
     /**
      * @brief Solve memory location with maximal reuse.
@@ -83,12 +94,15 @@ public:
 
 private:
     std::vector<Box> _boxes;
+    Strategy _strategy;
     std::map<int64_t, int64_t> _offsets;
     int64_t _top_depth = -1;
     int64_t _depth = -1;
     int _time_duration = -1;
 
     void calcDepth();
+    int64_t solveGreedy(std::map<int64_t, int64_t>& offsets) const;
+    int64_t solveBestFit(const std::vector<const Box*>& order, std::map<int64_t, int64_t>& offsets) const;
 };
 
 }  // namespace MKLDNNPlugin
@@ -137,6 +137,7 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "ReduceProd", ReduceProd},
         { "ReduceSum", ReduceSum},
         { "ReduceSumSquare", ReduceSumSquare},
+        { "Subgraph", Subgraph},
 };
 
 Type TypeFromName(const std::string type) {
@@ -744,9 +745,8 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
     for (size_t i = 0; i < internalBlobs.size(); i++) {
         const auto &internalBlob = internalBlobs[i];
 
+        auto newDesc = MKLDNNMemoryDesc(internalBlob->getTensorDesc());
         auto create = [&] () {
-            auto newDesc = MKLDNNMemoryDesc(internalBlob->getTensorDesc());
-
             MKLDNNMemory memory{ engine };
             memory.Create(newDesc, internalBlob->buffer());
 
@@ -759,12 +759,14 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
 
         MKLDNNMemoryPtr ptr;
         if (weightCache != nullptr) {
+            // The key depends on the weights content and layouts only, so the same weights of different
+            // nodes and networks are reordered and stored once
             const uint64_t data_hash = weightCache->GetHashFunc().hash(
                     internalBlob->buffer(), internalBlob->byteSize());
+            const uint64_t src_desc_hash = MKLDNNWeightsSharing::GetDescHash(newDesc);
 
-            const std::string string_hash = name + "_" + std::to_string(i)
-                                            + "_" + std::to_string(internalBlob->byteSize())
-                                            + "_" + std::to_string(data_hash);
+            const std::string string_hash = "weights_" + std::to_string(src_desc_hash) + "_"
+                                            + MKLDNNWeightsSharing::GetContentKey(data_hash, internalBlob->byteSize(), intDescs[i]);
 
             ptr = *weightCache->findOrCreate(string_hash, create);
         } else {
@@ -85,7 +85,8 @@ enum Type {
     ReduceOr,
     ReduceProd,
     ReduceSum,
-    ReduceSumSquare
+    ReduceSumSquare,
+    Subgraph
 };
 
 Type TypeFromName(const std::string type);
@@ -200,6 +201,8 @@ static std::string NameFromType(Type type) {
             return "ReduceSum";
         case ReduceSumSquare:
             return "ReduceSumSquare";
+        case Subgraph:
+            return "Subgraph";
         default:
             return "Unknown";
     }
@@ -15,6 +15,7 @@
 #include <vector>
 #include <tuple>
 #include <ie_system_conf.h>
+#include <xml_parse_utils.h>
 #include <nodes/list.hpp>
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_transformer.h>
@@ -82,8 +83,12 @@
 #include <low_precision/multiply_to_group_convolution.hpp>
 #include <low_precision/network_helper.hpp>
 
+#include <snippets/op/subgraph.hpp>
+#include <snippets/pass/collapse_subgraph.hpp>
+
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_quantize_node.h"
+#include "nodes/mkldnn_snippet_node.h"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
 # ifdef _WIN32
@@ -108,6 +113,61 @@ Engine::~Engine() {
     ExecutorManager::getInstance()->clear("CPUCallbackExecutor");
 }
 
+static bool isSnippetProfitable(const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph) {
+    size_t opsNum = 0;
+    for (const auto& op : subgraph->get_body()->get_ops()) {
+        if (!ngraph::op::is_parameter(op) && !ngraph::op::is_output(op) && !ngraph::op::is_constant(op))
+            opsNum++;
+    }
+    // a single operation doesn't save any memory traffic
+    if (opsNum < 2)
+        return false;
+
+    // the graph optimizer fuses elementwise tails into these layers, a snippet would only prevent it
+    for (const auto& input : subgraph->input_values()) {
+        const auto producer = input.get_node_shared_ptr();
+        if (ngraph::is_type<ngraph::opset1::Convolution>(producer) ||
+            ngraph::is_type<ngraph::opset1::GroupConvolution>(producer) ||
+            ngraph::is_type<ngraph::opset1::ConvolutionBackpropData>(producer) ||
+            ngraph::is_type<ngraph::opset1::GroupConvolutionBackpropData>(producer) ||
+            ngraph::is_type<ngraph::opset1::MatMul>(producer))
+            return false;
+    }
+
+    // outputs of multi-output layers are renamed by the legacy conversion, so they must not be network outputs
+    if (subgraph->get_output_size() > 1) {
+        for (const auto& output : subgraph->outputs()) {
+            for (const auto& consumer : output.get_target_inputs()) {
+                if (ngraph::op::is_output(consumer.get_node()))
+                    return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+static void TokenizeSnippets(const std::shared_ptr<ngraph::Function>& nGraphFunc) {
+    ngraph::pass::Manager snippetsManager;
+    snippetsManager.register_pass<ngraph::snippets::pass::TokenizeSnippets>();
+    snippetsManager.run_passes(nGraphFunc);
+
+    // snippets which can't be compiled or aren't worth it are unrolled back to be executed by regular nodes
+    for (const auto& op : nGraphFunc->get_ordered_ops()) {
+        auto subgraph = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(op);
+        if (!subgraph || (MKLDNNSnippetNode::isSupportedOperation(subgraph) && isSnippetProfitable(subgraph)))
+            continue;
+
+        auto body = ngraph::clone_function(*subgraph->get_body());
+        const auto& parameters = body->get_parameters();
+        for (size_t i = 0; i < parameters.size(); i++)
+            parameters[i]->output(0).replace(subgraph->input_value(i));
+        const auto& results = body->get_results();
+        for (size_t i = 0; i < results.size(); i++)
+            subgraph->output(i).replace(results[i]->input_value(0));
+    }
+}
+
 static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     auto nGraphFunc = clonedNetwork.getFunction();
 
@@ -276,6 +336,11 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
         transformer.transform(nGraphFunc);
     }
 
+    if (conf.enableSnippets && with_cpu_x86_sse42()) {
+        OV_ITT_SCOPED_TASK(MKLDNNPlugin::itt::domains::MKLDNN_LT, "TokenizeSnippets");
+        TokenizeSnippets(nGraphFunc);
+    }
+
     bool has_fake_quantize = ::ngraph::op::util::has_op_with_type<ngraph::op::FakeQuantize>(nGraphFunc);
 
     ngraph::pass::Manager legacyManager;
@@ -328,6 +393,19 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     }
 }
 
+static void TrimConstants(CNNNetwork& clonedNetwork) {
+    IE_SUPPRESS_DEPRECATED_START
+    auto icnnnet = static_cast<ICNNNetwork::Ptr>(clonedNetwork);
+    IE_SUPPRESS_DEPRECATED_END
+    auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(icnnnet);
+    if (implNetwork) {
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "CNNNet_based_ConstFolding");
+        // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
+        ConstTransformer transformator(implNetwork.get());
+        transformator.fullTrim();
+    }
+}
+
 InferenceEngine::ExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &config) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::LoadExeNetworkImpl");
@@ -363,21 +441,25 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
 
     CNNNetwork clonedNetwork = InferenceEngine::cloneNetwork(network);
 
-    bool is_transformed = false;
+    // A copy of the nGraph network is kept only if graphs of other input shapes are compiled from it or
+    // ExportImpl can't serialize the transformed legacy network. The application may change its own network.
+    CNNNetwork sourceNetwork;
+    MKLDNNExecNetwork::NetworkTransformer transformNetwork;
     if (clonedNetwork.getFunction()) {
-        Transformation(clonedNetwork, conf);
-        is_transformed = true;
-    }
-    IE_SUPPRESS_DEPRECATED_START
-    auto icnnnet = static_cast<ICNNNetwork::Ptr>(clonedNetwork);
-    IE_SUPPRESS_DEPRECATED_END
-    auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(icnnnet);
-    if (implNetwork) {
-        OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "CNNNet_based_ConstFolding");
-        // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
-        ConstTransformer transformator(implNetwork.get());
-        transformator.fullTrim();
-        if (!is_transformed) {
+        transformNetwork = [conf] (CNNNetwork& nGraphNetwork) {
+            Transformation(nGraphNetwork, conf);
+            TrimConstants(nGraphNetwork);
+        };
+        transformNetwork(clonedNetwork);
+        if (conf.shapeCacheCapacity > 0 || !MKLDNNExecNetwork::CanExportLegacyNetwork(clonedNetwork)) {
+            sourceNetwork = InferenceEngine::cloneNetwork(network);
+        }
+    } else {
+        TrimConstants(clonedNetwork);
+        IE_SUPPRESS_DEPRECATED_START
+        auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(static_cast<ICNNNetwork::Ptr>(clonedNetwork));
+        IE_SUPPRESS_DEPRECATED_END
+        if (implNetwork) {
             InferenceEngine::CNNNetwork implNetworkWrapper(implNetwork);
             NetPass::ConvertPrecision(implNetworkWrapper, Precision::I64, Precision::I32);
             NetPass::ConvertPrecision(implNetworkWrapper, Precision::U64, Precision::I32);
@@ -389,7 +471,89 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         }
     }
 
-    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing, sourceNetwork, transformNetwork);
+}
+
+InferenceEngine::ExecutableNetwork Engine::ImportNetworkImpl(std::istream& networkModel,
+                                                             const std::map<std::string, std::string>& config) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::ImportNetworkImpl");
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with CPU device via InferencEngine::Core object";
+    }
+
+    std::string headerXmlStr;
+    std::getline(networkModel, headerXmlStr);
+
+    pugi::xml_document headerXmlDoc;
+    pugi::xml_parse_result res = headerXmlDoc.load_string(headerXmlStr.c_str());
+    if (res.status != pugi::status_ok) {
+        THROW_IE_EXCEPTION_WITH_STATUS(NETWORK_NOT_READ) << "Error reading CPU plugin xml header";
+    }
+
+    using namespace XMLParseUtils;
+
+    pugi::xml_node cpuNode = headerXmlDoc.document_element();
+
+    // configuration the network was compiled with is overridden by the import time one
+    std::map<std::string, std::string> importedConfig;
+    auto configsNode = cpuNode.child("configs");
+    FOREACH_CHILD(configNode, configsNode, "config") {
+        importedConfig[GetStrAttr(configNode, "key")] = GetStrAttr(configNode, "value");
+    }
+    // BF16 could be enforced by the exporting host only
+    if (!with_cpu_x86_bfloat16()) {
+        importedConfig.erase(PluginConfigParams::KEY_ENFORCE_BF16);
+    }
+    for (auto&& kvp : config) {
+        importedConfig[kvp.first] = kvp.second;
+    }
+
+    std::string xmlString;
+    std::uint64_t dataSize = 0;
+    networkModel.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+    xmlString.resize(dataSize);
+    networkModel.read(&xmlString[0], dataSize);
+
+    Blob::Ptr dataBlob;
+    networkModel.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+    if (0 != dataSize) {
+        dataBlob = make_shared_blob<std::uint8_t>(
+            TensorDesc(Precision::U8, {static_cast<std::size_t>(dataSize)}, Layout::C));
+        dataBlob->allocate();
+        networkModel.read(dataBlob->buffer(), dataSize);
+    }
+    if (!networkModel.good()) {
+        THROW_IE_EXCEPTION_WITH_STATUS(NETWORK_NOT_READ) << "Exported CPU network stream is truncated";
+    }
+
+    // A legacy network is read by the IR v7 reader and is compiled without the nGraph transformations,
+    // they were applied before export
+    auto cnnnetwork = GetCore()->ReadNetwork(xmlString, std::move(dataBlob));
+
+    // restore inputs and outputs info set by the user before export
+    auto inputs = cnnnetwork.getInputsInfo();
+    auto inputsNode = cpuNode.child("inputs");
+    FOREACH_CHILD(inputNode, inputsNode, "input") {
+        auto input = inputs.find(GetStrAttr(inputNode, "name"));
+        if (input == inputs.end()) {
+            THROW_IE_EXCEPTION_WITH_STATUS(NETWORK_NOT_READ) << "Exported CPU network has unknown input " << GetStrAttr(inputNode, "name");
+        }
+        input->second->setPrecision(Precision::FromStr(GetStrAttr(inputNode, "precision")));
+        input->second->setLayout(static_cast<Layout>(GetIntAttr(inputNode, "layout")));
+    }
+
+    auto outputs = cnnnetwork.getOutputsInfo();
+    auto outputsNode = cpuNode.child("outputs");
+    FOREACH_CHILD(outputNode, outputsNode, "output") {
+        auto output = outputs.find(GetStrAttr(outputNode, "name"));
+        if (output == outputs.end()) {
+            THROW_IE_EXCEPTION_WITH_STATUS(NETWORK_NOT_READ) << "Exported CPU network has unknown output " << GetStrAttr(outputNode, "name");
+        }
+        output->second->setPrecision(Precision::FromStr(GetStrAttr(outputNode, "precision")));
+        output->second->setLayout(static_cast<Layout>(GetIntAttr(outputNode, "layout")));
+    }
+
+    return LoadNetwork(cnnnetwork, importedConfig);
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -432,6 +596,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -478,6 +643,9 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        // imported networks are compiled without the nGraph transformations, see MKLDNNExecNetwork::ExportImpl
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
     } else {
         THROW_IE_EXCEPTION << "Unsupported metric key " << name;
     }
@@ -5,10 +5,125 @@
 #include "mkldnn_weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
+namespace {
+
+constexpr uint64_t kPolynomial = 0xc96c5795d7870f42;
+// Buffers smaller than this are hashed by a single thread
+constexpr size_t kMinParallelChunkSize = 1 << 20;
+
+uint64_t gf2MatrixTimes(const uint64_t* mat, uint64_t vec) {
+    uint64_t sum = 0;
+    for (; vec; vec >>= 1, mat++)
+        if (vec & 1) sum ^= *mat;
+    return sum;
+}
+
+void gf2MatrixSquare(uint64_t* square, const uint64_t* mat) {
+    for (int n = 0; n < 64; n++)
+        square[n] = gf2MatrixTimes(mat, mat[n]);
+}
+
+}  // namespace
+
+SimpleDataHash::SimpleDataHash() {
+    for (int i = 0; i < kTableSize; i++) {
+        uint64_t c = i;
+        for (int j = 0; j < 8; j++)
+            c = ((c & 1) ? kPolynomial : 0) ^ (c >> 1);
+        table[0][i] = c;
+    }
+    for (int i = 0; i < kTableSize; i++) {
+        for (int k = 1; k < kSlices; k++)
+            table[k][i] = table[0][table[k - 1][i] & 0xff] ^ (table[k - 1][i] >> 8);
+    }
+}
+
+uint64_t SimpleDataHash::update(uint64_t crc, const unsigned char* data, size_t size) const {
+    for (; size >= kSlices; size -= kSlices, data += kSlices) {
+        crc ^= static_cast<uint64_t>(data[0])       | static_cast<uint64_t>(data[1]) << 8  |
+               static_cast<uint64_t>(data[2]) << 16 | static_cast<uint64_t>(data[3]) << 24 |
+               static_cast<uint64_t>(data[4]) << 32 | static_cast<uint64_t>(data[5]) << 40 |
+               static_cast<uint64_t>(data[6]) << 48 | static_cast<uint64_t>(data[7]) << 56;
+        crc = table[7][crc & 0xff]         ^ table[6][(crc >> 8) & 0xff]  ^
+              table[5][(crc >> 16) & 0xff] ^ table[4][(crc >> 24) & 0xff] ^
+              table[3][(crc >> 32) & 0xff] ^ table[2][(crc >> 40) & 0xff] ^
+              table[1][(crc >> 48) & 0xff] ^ table[0][crc >> 56];
+    }
+    for (; size > 0; size--, data++)
+        crc = table[0][(unsigned char)crc ^ *data] ^ (crc >> 8);
+    return crc;
+}
+
+// Sum of the concatenation of two buffers from the sums of them, the same approach as crc32_combine of zlib.
+// The sum is computed from zero initial value, so it is linear and crc(A|B) = crc(A) shifted by |B| zero bytes ^ crc(B).
+uint64_t SimpleDataHash::combine(uint64_t crc1, uint64_t crc2, size_t size2) const {
+    if (size2 == 0)
+        return crc1;
+
+    uint64_t even[64];  // even-power-of-two zeros operator
+    uint64_t odd[64];   // odd-power-of-two zeros operator
+
+    // operator for one zero bit
+    odd[0] = kPolynomial;
+    uint64_t row = 1;
+    for (int n = 1; n < 64; n++) {
+        odd[n] = row;
+        row <<= 1;
+    }
+    gf2MatrixSquare(even, odd);  // two zero bits
+    gf2MatrixSquare(odd, even);  // four zero bits
+
+    // apply size2 zero bytes to crc1, the first squaring gives the operator for one zero byte
+    do {
+        gf2MatrixSquare(even, odd);
+        if (size2 & 1)
+            crc1 = gf2MatrixTimes(even, crc1);
+        size2 >>= 1;
+        if (size2 == 0)
+            break;
+
+        gf2MatrixSquare(odd, even);
+        if (size2 & 1)
+            crc1 = gf2MatrixTimes(odd, crc1);
+        size2 >>= 1;
+    } while (size2 != 0);
+
+    return crc1 ^ crc2;
+}
+
+uint64_t SimpleDataHash::serialHash(const unsigned char* data, size_t size) const {
+    return ~update(0, data, size);
+}
+
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size) const {
+    const int nthr = static_cast<int>(std::min<size_t>(parallel_get_max_threads(), size / kMinParallelChunkSize));
+    if (nthr <= 1)
+        return serialHash(data, size);
+
+    std::vector<uint64_t> crcs(nthr);
+    std::vector<size_t> sizes(nthr);
+    parallel_nt(nthr, [&](const int ithr, const int nthreads) {
+        size_t start = 0, end = 0;
+        splitter(size, nthreads, ithr, start, end);
+        sizes[ithr] = end - start;
+        crcs[ithr] = update(0, data + start, end - start);
+    });
+
+    uint64_t crc = crcs[0];
+    for (int i = 1; i < nthr; i++)
+        crc = combine(crc, crcs[i], sizes[i]);
+    return ~crc;
+}
+
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
 MKLDNNWeightsSharing::MKLDNNSharedMemory::MKLDNNSharedMemory(
@@ -55,6 +170,42 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreate
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+uint64_t MKLDNNWeightsSharing::GetDescHash(const MKLDNNMemoryDesc& memDesc) {
+    const mkldnn::memory::desc desc = memDesc;
+    const auto& data = desc.data;
+    // Only the fields used by the descriptor are hashed, unused dims and padding bytes of the structure may differ
+    std::vector<int64_t> fields{data.ndims, data.data_type, data.format_kind, data.offset0};
+    fields.insert(fields.end(), data.dims, data.dims + data.ndims);
+    fields.insert(fields.end(), data.padded_dims, data.padded_dims + data.ndims);
+    fields.insert(fields.end(), data.padded_offsets, data.padded_offsets + data.ndims);
+    if (data.format_kind == dnnl_blocked) {
+        const auto& blk = data.format_desc.blocking;
+        fields.insert(fields.end(), blk.strides, blk.strides + data.ndims);
+        fields.push_back(blk.inner_nblks);
+        fields.insert(fields.end(), blk.inner_blks, blk.inner_blks + blk.inner_nblks);
+        fields.insert(fields.end(), blk.inner_idxs, blk.inner_idxs + blk.inner_nblks);
+    }
+    int32_t scaleAdjust;
+    std::memcpy(&scaleAdjust, &data.extra.scale_adjust, sizeof(scaleAdjust));
+    fields.push_back(static_cast<int64_t>(data.extra.flags));
+    fields.push_back(data.extra.compensation_mask);
+    fields.push_back(scaleAdjust);
+
+    uint64_t hash = simpleCRC.hash(reinterpret_cast<const unsigned char*>(fields.data()), fields.size() * sizeof(int64_t));
+    if (data.format_kind != dnnl_blocked) {
+        // Winograd and RNN packed formats are rare for weights, hashing their raw bytes can only make
+        // equal descriptors miss each other
+        hash ^= simpleCRC.hash(reinterpret_cast<const unsigned char*>(&data.format_desc), sizeof(data.format_desc));
+    }
+    return hash;
+}
+
+std::string MKLDNNWeightsSharing::GetContentKey(uint64_t dataHash, size_t dataSize, const MKLDNNMemoryDesc& dstDesc) {
+    const mkldnn::memory::desc desc = dstDesc;
+    return std::to_string(dataSize) + "_" + std::to_string(dataHash) + "_"
+           + std::to_string(desc.get_size()) + "_" + std::to_string(GetDescHash(dstDesc));
+}
+
 MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const std::string& key) const {
     std::unique_lock<std::mutex> lock(guard);
     auto found = sharedWeights.find(key);
@@ -21,28 +21,28 @@
 
 namespace MKLDNNPlugin {
 
+/**
+ * 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
+ *
+ * Data is processed 8 bytes per step (slicing-by-8), big buffers are split into chunks hashed in parallel.
+ * Chunk sums are combined into the sum of the whole buffer, so the result does not depend on the number of threads.
+ */
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
+    SimpleDataHash();
+
+    uint64_t hash(const unsigned char* data, size_t size) const;
+
+    /** Single threaded version of hash(), gives the same result */
+    uint64_t serialHash(const unsigned char* data, size_t size) const;
 
 protected:
+    uint64_t update(uint64_t crc, const unsigned char* data, size_t size) const;
+    uint64_t combine(uint64_t crc1, uint64_t crc2, size_t size2) const;
+
     static const int kTableSize = 256;
-    uint64_t table[kTableSize];
+    static const int kSlices = 8;
+    uint64_t table[kSlices][kTableSize];
 };
 
 /**
@@ -94,6 +94,19 @@ public:
 
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
+    /**
+     * Hashes the fields of the memory descriptor which define the layout, so equal descriptors get
+     * the same hash regardless of the unused parts of the underlying structure.
+     */
+    static uint64_t GetDescHash(const MKLDNNMemoryDesc& desc);
+
+    /**
+     * Builds a key of memory produced from the source data with the given content hash and size.
+     * The key does not depend on the network the data belongs to, so the memory is shared between
+     * all networks loaded to the same plugin which have the same data in the same target layout.
+     */
+    static std::string GetContentKey(uint64_t dataHash, size_t dataSize, const MKLDNNMemoryDesc& dstDesc);
+
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MKLDNNMemoryInfo::Ptr> sharedWeights;
@@ -113,7 +113,8 @@ public:
             _num_priors_actual->allocate();
 
             std::vector<DataConfigurator> in_data_conf(layer->insData.size(), DataConfigurator(ConfLayout::PLN, Precision::FP32));
-            addConfig(layer, in_data_conf, {DataConfigurator(ConfLayout::PLN, Precision::FP32)});
+            // the number of images is taken from the inputs, so the layer supports dynamic batch
+            addConfig(layer, in_data_conf, {DataConfigurator(ConfLayout::PLN, Precision::FP32)}, true);
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
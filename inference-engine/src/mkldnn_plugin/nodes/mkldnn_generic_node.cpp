@@ -108,47 +108,31 @@ void MKLDNNGenericNode::cleanup() {
 }
 
 void MKLDNNGenericNode::execLayer() {
-    bool isDynBatch = dynBatchLim > 0;
+    // Implementations declaring dynamic batch support get the tensors limited to the processed batch.
+    // Tensors which don't have the batch as the first dimension (e.g. priors or detections) are passed as is.
+    const int maxBatch = getMaxBatch();
+    const int batch = batchToProcess();
+    const bool isDynBatch = batch < maxBatch && getSelectedPrimitiveDescriptor() != nullptr &&
+                            getSelectedPrimitiveDescriptor()->getConfig().dynBatchSupport;
+    auto limitBatch = [&](const InferenceEngine::Blob::Ptr& blob, const MKLDNNMemory& memory) {
+        auto desc = blob->getTensorDesc();
+        if (!isDynBatch || desc.getLayout() == InferenceEngine::Layout::BLOCKED || desc.getDims().empty() ||
+            desc.getDims()[0] != static_cast<size_t>(maxBatch))
+            return blob;
+        auto dims = desc.getDims();
+        dims[0] = static_cast<size_t>(batch);
+        desc.setDims(dims);
+        return make_blob_with_precision(desc, memory.GetData());
+    };
+
     std::vector<InferenceEngine::Blob::Ptr> inputs;
-    std::vector<InferenceEngine::Blob::CPtr> constInputs;
-    std::vector<InferenceEngine::TensorDesc> inputDescs;
-    std::vector<InferenceEngine::SizeVector> outputShapes;
     for (size_t i = 0; i < getParentEdges().size(); i++) {
-        auto inputBlob = getParentEdgeAt(i)->getBlob();
-        inputs.push_back(inputBlob);
-        constInputs.push_back(inputBlob);
-        if (isDynBatch && dynBatchLim >= inputs[inputs.size() - 1]->getTensorDesc().getDims()[0]) {
-            isDynBatch = false;
-        } else {
-            // TODO: Ask the right dims using getShape() from previous node
-            inputDescs.push_back(inputs[inputs.size() - 1]->getTensorDesc());
-            if (inputDescs[inputDescs.size() - 1].getDims().size() > 0)
-                inputDescs[inputDescs.size() - 1].getDims()[0] = static_cast<size_t>(batchToProcess());
-        }
-    }
-
-    if (isDynBatch) {
-        // TODO: use ngraph-based extension mechnism if needed to recompute shape
-        isDynBatch = false;
-    }
-
-    if (isDynBatch) {
-        for (size_t i = 0; i < inputs.size(); i++) {
-            auto td = inputs[i]->getTensorDesc();
-            td.setDims(inputDescs[i].getDims());
-            inputs[i] = make_blob_with_precision(td, getParentEdgeAt(i)->getMemory().GetData());
-        }
+        inputs.push_back(limitBatch(getParentEdgeAt(i)->getBlob(), getParentEdgeAt(i)->getMemory()));
     }
     std::vector<InferenceEngine::Blob::Ptr> outputs;
     for (size_t i = 0; i < outDims.size(); i++) {
-        if (isDynBatch) {
-            auto out_edge = getChildEdgesAtPort(i)[0];
-            auto td = out_edge->getBlob()->getTensorDesc();
-            td.setDims(outputShapes[i]);
-            outputs.push_back(make_blob_with_precision(td, out_edge->getMemory().GetData()));
-        } else {
-            outputs.push_back(getChildEdgesAtPort(i)[0]->getBlob());
-        }
+        auto outEdge = getChildEdgesAtPort(i)[0];
+        outputs.push_back(limitBatch(outEdge->getBlob(), outEdge->getMemory()));
     }
     InferenceEngine::ResponseDesc resp;
     InferenceEngine::StatusCode rc = impls[0]->execute(inputs, outputs, &resp);
@@ -0,0 +1,288 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_snippet_node.h"
+
+#include <algorithm>
+#include <numeric>
+#include <set>
+#include <string>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <mkldnn_extension_utils.h>
+#include <cpu/x64/cpu_isa_traits.hpp>
+
+#include "ie_parallel.hpp"
+#include "common/tensor_desc_creator.h"
+#include "emitters/cpu_generator.hpp"
+
+#define THROW_ERROR THROW_IE_EXCEPTION << getTypeStr() << " layer with name '" << getName() <<"' ERROR: "
+
+using namespace mkldnn;
+using namespace mkldnn::impl::cpu::x64;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+const std::set<ngraph::NodeTypeInfo>& getSupportedBodyOps() {
+    static const std::set<ngraph::NodeTypeInfo> supportedOps = {
+        ngraph::opset1::Parameter::type_info,
+        ngraph::opset1::Result::type_info,
+        ngraph::opset1::Constant::type_info,
+
+        ngraph::opset1::Add::type_info,
+        ngraph::opset1::Subtract::type_info,
+        ngraph::opset1::Multiply::type_info,
+        ngraph::opset1::Divide::type_info,
+        ngraph::opset1::Maximum::type_info,
+        ngraph::opset1::Minimum::type_info,
+        ngraph::opset1::Mod::type_info,
+        ngraph::opset1::FloorMod::type_info,
+        ngraph::opset1::SquaredDifference::type_info,
+        ngraph::opset1::Power::type_info,
+        ngraph::opset1::PRelu::type_info,
+
+        ngraph::opset1::Negative::type_info,
+        ngraph::opset1::Sqrt::type_info,
+        ngraph::opset1::Relu::type_info,
+        ngraph::opset1::Sigmoid::type_info,
+        ngraph::opset1::Tanh::type_info,
+        ngraph::opset1::Elu::type_info,
+        ngraph::opset1::Exp::type_info,
+        ngraph::opset1::Abs::type_info,
+        ngraph::opset1::Clamp::type_info,
+    };
+    return supportedOps;
+}
+
+size_t getInnermostDim(const ngraph::Shape& shape) {
+    return shape.empty() ? 1 : shape.back();
+}
+
+SizeVector padDims(SizeVector dims, size_t rank) {
+    dims.insert(dims.begin(), rank - dims.size(), 1);
+    return dims;
+}
+
+}  // namespace
+
+bool MKLDNNSnippetNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op) {
+    auto subgraph = std::dynamic_pointer_cast<const ngraph::snippets::op::Subgraph>(op);
+    if (!subgraph)
+        return false;
+
+    if (op->get_input_size() + op->get_output_size() > jit_snippets_call_args::maxArgs)
+        return false;
+
+    for (const auto& input : op->inputs()) {
+        if (input.get_element_type() != ngraph::element::f32 || input.get_partial_shape().is_dynamic())
+            return false;
+    }
+    for (const auto& output : op->outputs()) {
+        if (output.get_element_type() != ngraph::element::f32 || output.get_partial_shape().is_dynamic() ||
+            output.get_shape() != op->get_output_shape(0))
+            return false;
+    }
+
+    const auto& supportedOps = getSupportedBodyOps();
+    for (const auto& node : subgraph->get_body()->get_ordered_ops()) {
+        if (supportedOps.count(node->get_type_info()) == 0)
+            return false;
+        if (ngraph::is_type<ngraph::opset1::Constant>(node) && ngraph::shape_size(node->get_shape()) != 1)
+            return false;
+        // slope is broadcasted per channel which is not the numpy rule the kernel follows
+        if (ngraph::is_type<ngraph::opset1::PRelu>(node) && !ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(1)))
+            return false;
+        if (auto binary = std::dynamic_pointer_cast<ngraph::op::util::BinaryElementwiseArithmetic>(node)) {
+            if (binary->get_autob().m_type == ngraph::op::AutoBroadcastType::PDPD)
+                return false;
+        }
+    }
+
+    // an input broadcasted by the innermost dimension is loaded with a single element broadcast,
+    // which is only possible if it's consumed by an operation producing full rows
+    const size_t innermostDim = getInnermostDim(op->get_output_shape(0));
+    for (const auto& parameter : subgraph->get_body()->get_parameters()) {
+        if (getInnermostDim(parameter->get_shape()) != 1 || innermostDim == 1)
+            continue;
+        const auto consumers = parameter->output(0).get_target_inputs();
+        if (consumers.size() != 1 || getInnermostDim(consumers.begin()->get_node()->get_output_shape(0)) == 1)
+            return false;
+    }
+
+    return true;
+}
+
+MKLDNNSnippetNode::MKLDNNSnippetNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
+        MKLDNNNode(layer, eng, cache) {
+    auto original = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(layer->getNode());
+    if (!original)
+        THROW_ERROR << "Cannot get snippets subgraph operation";
+    if (!isSupportedOperation(original))
+        THROW_ERROR << "Snippet is not supported by CPU plugin";
+
+    // code generation transforms the body in place, so the node works on its own copy
+    ngraph::OutputVector args;
+    for (size_t i = 0; i < original->get_input_size(); i++)
+        args.push_back(std::make_shared<ngraph::opset1::Parameter>(original->get_input_element_type(i), original->get_input_partial_shape(i)));
+    snippet = std::make_shared<ngraph::snippets::op::Subgraph>(args, ngraph::clone_function(*original->get_body()));
+    snippet->set_friendly_name(original->get_friendly_name());
+}
+
+MKLDNNSnippetNode::~MKLDNNSnippetNode() = default;
+
+void MKLDNNSnippetNode::getSupportedDescriptors() {
+    if (getParentEdges().size() != snippet->get_input_size())
+        THROW_ERROR << "Incorrect number of input edges";
+    if (getChildEdges().empty())
+        THROW_ERROR << "Incorrect number of output edges";
+}
+
+void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    impl_desc_type impl_type;
+    if (mayiuse(cpu::x64::avx512_common)) {
+        impl_type = impl_desc_type::jit_avx512;
+    } else if (mayiuse(cpu::x64::avx2)) {
+        impl_type = impl_desc_type::jit_avx2;
+    } else if (mayiuse(cpu::x64::sse41)) {
+        impl_type = impl_desc_type::jit_sse42;
+    } else {
+        THROW_ERROR << "Snippets require SSE4.1 at least";
+    }
+
+    const auto& creator = TensorDescCreator::getCommonCreators().at(TensorDescCreatorTypes::ncsp);
+
+    LayerConfig config;
+    config.dynBatchSupport = false;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = creator->createDesc(Precision::FP32, getParentEdgeAt(i)->getDims().ToSizeVector());
+        config.inConfs.push_back(dataConfig);
+    }
+    for (size_t i = 0; i < outDims.size(); i++) {
+        DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = creator->createDesc(Precision::FP32, outDims[i].ToSizeVector());
+        config.outConfs.push_back(dataConfig);
+    }
+
+    supportedPrimitiveDescriptors.emplace_back(config, impl_type, MKLDNNMemoryDesc(config.outConfs.front().desc).getFormat());
+}
+
+void MKLDNNSnippetNode::createPrimitive() {
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_ERROR << "Preferable primitive descriptor is not set.";
+    if (ker != nullptr)
+        return;
+
+    std::vector<SizeVector> inputDims;
+    for (size_t i = 0; i < getParentEdges().size(); i++)
+        inputDims.push_back(getParentEdgeAt(i)->getDims().ToSizeVector());
+
+    // canonical form of a snippet has at least 4 dimensions
+    size_t rank = std::max<size_t>(4, outDims[0].ndims());
+    for (const auto& dims : inputDims)
+        rank = std::max(rank, dims.size());
+
+    ngraph::AxisVector order(rank);
+    std::iota(order.begin(), order.end(), 0);
+
+    ngraph::snippets::op::Subgraph::BlockedShapeVector inputShapes;
+    for (const auto& dims : inputDims)
+        inputShapes.emplace_back(ngraph::Shape(padDims(dims, rank)), order, ngraph::element::f32);
+    ngraph::snippets::op::Subgraph::BlockedShapeVector outputShapes;
+    for (size_t i = 0; i < outDims.size(); i++)
+        outputShapes.emplace_back(ngraph::Shape(padDims(outDims[i].ToSizeVector(), rank)), order, ngraph::element::f32);
+
+    cpu_isa_t isa = mayiuse(cpu::x64::avx512_common) ? cpu::x64::avx512_common :
+                    mayiuse(cpu::x64::avx2) ? cpu::x64::avx2 : cpu::x64::sse41;
+    generator = std::make_shared<CPUGenerator>(isa);
+    snippet->set_generator(generator);
+    auto schedule = snippet->generate(outputShapes, inputShapes);
+
+    ker = reinterpret_cast<kernel>(schedule.ptr);
+    vectorLength = generator->getVectorLength();
+    workDims = SizeVector(schedule.work_size.begin(), schedule.work_size.end());
+    if (workDims.size() != rank)
+        THROW_ERROR << "Unexpected rank of the snippet schedule";
+
+    isFlat = true;
+    inputStrides.clear();
+    for (const auto& dims : inputDims) {
+        const auto padded = padDims(dims, rank);
+        std::vector<size_t> strides(rank, 0);
+        size_t stride = 1;
+        for (int d = static_cast<int>(rank) - 1; d >= 0; d--) {
+            strides[d] = padded[d] == workDims[d] ? stride : 0;
+            stride *= padded[d];
+        }
+        isFlat = isFlat && padded == workDims;
+        inputStrides.push_back(strides);
+    }
+}
+
+void MKLDNNSnippetNode::execute(mkldnn::stream strm) {
+    std::vector<const uint8_t*> srcPtrs;
+    for (size_t i = 0; i < getParentEdges().size(); i++)
+        srcPtrs.push_back(reinterpret_cast<const uint8_t*>(getParentEdgeAt(i)->getMemory().GetPtr()));
+    std::vector<uint8_t*> dstPtrs;
+    for (size_t i = 0; i < outDims.size(); i++)
+        dstPtrs.push_back(reinterpret_cast<uint8_t*>(getChildEdgesAtPort(i)[0]->getMemory().GetPtr()));
+
+    const size_t totalAmount = std::accumulate(workDims.begin(), workDims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+
+    if (isFlat) {
+        // all tensors have the same shape, so the whole tensor is a single row split between threads by vector multiples
+        const size_t vectorsNum = (totalAmount + vectorLength - 1) / vectorLength;
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(vectorsNum, nthr, ithr, start, end);
+            start = std::min(start * vectorLength, totalAmount);
+            end = std::min(end * vectorLength, totalAmount);
+            if (start >= end)
+                return;
+
+            jit_snippets_call_args args;
+            for (size_t i = 0; i < srcPtrs.size(); i++)
+                args.ptrs[i] = srcPtrs[i] + start * sizeof(float);
+            for (size_t i = 0; i < dstPtrs.size(); i++)
+                args.ptrs[srcPtrs.size() + i] = dstPtrs[i] + start * sizeof(float);
+            args.work_amount = end - start;
+            ker(&args);
+        });
+        return;
+    }
+
+    const size_t rank = workDims.size();
+    const size_t rowLength = workDims.back();
+    const size_t rowsNum = totalAmount / rowLength;
+    parallel_for(rowsNum, [&](size_t row) {
+        jit_snippets_call_args args;
+        for (size_t i = 0; i < srcPtrs.size(); i++) {
+            size_t offset = 0;
+            size_t index = row;
+            for (int d = static_cast<int>(rank) - 2; d >= 0; d--) {
+                offset += (index % workDims[d]) * inputStrides[i][d];
+                index /= workDims[d];
+            }
+            args.ptrs[i] = srcPtrs[i] + offset * sizeof(float);
+        }
+        for (size_t i = 0; i < dstPtrs.size(); i++)
+            args.ptrs[srcPtrs.size() + i] = dstPtrs[i] + row * rowLength * sizeof(float);
+        args.work_amount = rowLength;
+        ker(&args);
+    });
+}
+
+bool MKLDNNSnippetNode::created() const {
+    return getType() == Subgraph;
+}
+REG_MKLDNN_PRIM_FOR(MKLDNNSnippetNode, Subgraph);
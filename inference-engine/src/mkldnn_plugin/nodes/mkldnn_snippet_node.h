@@ -0,0 +1,57 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <memory>
+#include <vector>
+
+#include <snippets/op/subgraph.hpp>
+
+namespace MKLDNNPlugin {
+
+class CPUGenerator;
+
+/**
+ * @brief Executes a chain of elementwise operations collapsed into a snippets::op::Subgraph
+ * with a single kernel produced by CPUGenerator, so intermediate tensors never reach memory.
+ */
+class MKLDNNSnippetNode : public MKLDNNNode {
+public:
+    MKLDNNSnippetNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNSnippetNode() override;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+    bool canBeInPlace() const override {
+        return false;
+    }
+
+    /**
+     * @brief Checks if the subgraph can be compiled and executed by the node:
+     * static FP32 shapes, numpy broadcasting only and every operation has an emitter.
+     */
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op);
+
+private:
+    using kernel = void (*)(const void*);
+
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+    std::shared_ptr<CPUGenerator> generator;
+    kernel ker = nullptr;
+
+    size_t vectorLength = 0;
+    bool isFlat = false;
+    // work dims of the kernel, its innermost dimension is a row processed by one call
+    std::vector<size_t> workDims;
+    // per input strides aligned with workDims, zero for broadcasted dimensions
+    std::vector<std::vector<size_t>> inputStrides;
+};
+
+}  // namespace MKLDNNPlugin
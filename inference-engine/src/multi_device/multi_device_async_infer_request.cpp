@@ -28,6 +28,7 @@ MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
         void run(Task task) override {
             auto workerInferRequest = _this->_workerInferRequest;
             workerInferRequest->_task = std::move(task);
+            workerInferRequest->_startTime = std::chrono::steady_clock::now();
             workerInferRequest->_inferRequest.StartAsync();
         };
         MultiDeviceAsyncInferRequest* _this = nullptr;
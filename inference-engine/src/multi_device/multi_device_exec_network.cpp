@@ -10,6 +10,9 @@
 #include <utility>
 #include <map>
 #include <unordered_map>
+#include <algorithm>
+#include <chrono>
+#include <limits>
 
 
 #include "ie_metric_helpers.hpp"
@@ -53,17 +56,20 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                                                            const std::unordered_map<std::string, InferenceEngine::Parameter>&   config,
                                                            const bool                                                           needPerfCounters) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
-    _devicePriorities{networkDevices},
+    _devicePriorities{std::make_shared<const std::vector<DeviceInformation>>(networkDevices)},
     _devicePrioritiesInitial{networkDevices},
     _networksPerDevice{networksPerDevice},
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
+    auto itSchedulingPolicy = _config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    _expectedFinishTimeScheduling = itSchedulingPolicy != _config.end() &&
+        itSchedulingPolicy->second.as<std::string>() == MultiDeviceConfigParams::MULTI_EXPECTED_FINISH_TIME;
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
 
-        auto itNumRequests = std::find_if(_devicePriorities.cbegin(), _devicePriorities.cend(),
+        auto itNumRequests = std::find_if(_devicePrioritiesInitial.cbegin(), _devicePrioritiesInitial.cend(),
                 [&device](const DeviceInformation& d){ return d.deviceName == device;});
         unsigned int optimalNum = 0;
         try {
@@ -74,12 +80,15 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                     << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
                     << "Failed to query the metric for the " << device << " with error:" << iie.what();
         }
-        const auto numRequests = (_devicePriorities.end() == itNumRequests ||
+        const auto numRequests = (_devicePrioritiesInitial.end() == itNumRequests ||
             itNumRequests->numRequestsPerDevices == -1) ? optimalNum : itNumRequests->numRequestsPerDevices;
         auto& workerRequests = _workerRequests[device];
         auto& idleWorkerRequests = _idleWorkerRequests[device];
         workerRequests.resize(numRequests);
+        _inferPipelineTasks[device] = std::unique_ptr<ThreadSafeQueue<Task>>(new ThreadSafeQueue<Task>);
         _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<ThreadSafeQueue<Task>>(new ThreadSafeQueue<Task>);
+        _deviceStatistics[device] = std::unique_ptr<DeviceStatistics>(new DeviceStatistics);
+        auto* deviceStatisticsPtr = _deviceStatistics[device].get();
         auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
         idleWorkerRequests.set_capacity(numRequests);
         for (auto&& workerRequest : workerRequests) {
@@ -87,35 +96,153 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
             auto* workerRequestPtr = &workerRequest;
             IE_ASSERT(idleWorkerRequests.try_push(workerRequestPtr) == true);
             workerRequest._inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
-                [workerRequestPtr, this, device, idleWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
+                [workerRequestPtr, this, device, idleWorkerRequestsPtr, deviceStatisticsPtr] (InferRequest , StatusCode status) mutable {
                     IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                     workerRequestPtr->_status = status;
+                    deviceStatisticsPtr->_numCompletedRequests++;
+                    UpdateAverageLatency(*deviceStatisticsPtr, std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(
+                        std::chrono::steady_clock::now() - workerRequestPtr->_startTime).count());
                     {
                         auto capturedTask = std::move(workerRequestPtr->_task);
                         capturedTask();
                     }
                     // try to return the request to the idle list (fails if the overall object destruction has began)
                     if (idleGuard.Release()->try_push(workerRequestPtr)) {
-                        // let's try to pop a task, as we know there is at least one idle request, schedule if succeeded
-                        // if no device-agnostic tasks, let's try pop the device specific task, schedule if succeeded
-                        Task t;
-                        if (_inferPipelineTasks.try_pop(t))
-                            ScheduleToWorkerInferRequest(std::move(t));
-                        else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t))
-                            ScheduleToWorkerInferRequest(std::move(t), device);
+                        // as we know there is at least one idle request, let's try to pop a task for the device
+                        // (device specific, queued to the device or stolen from other devices) and schedule it
+                        ScheduleQueuedTask(device);
                     }
                 });
         }
     }
 }
 
-void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipelineTask, DeviceName preferred_device) {
-    auto devices = [&] {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _devicePriorities;
-    }();
+MultiDeviceExecutableNetwork::DevicePriorities MultiDeviceExecutableNetwork::GetDevicePriorities() const {
+    // the lock only protects copying of the pointer, the vector itself is never modified
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _devicePriorities;
+}
+
+void MultiDeviceExecutableNetwork::UpdateAverageLatency(DeviceStatistics& statistics, double latency) {
+    constexpr double smoothingFactor = 0.1;
+    auto average = statistics._averageLatency.load();
+    double updated = 0.;
+    do {
+        updated = average > 0. ? average + smoothingFactor * (latency - average) : latency;
+    } while (!statistics._averageLatency.compare_exchange_weak(average, updated));
+}
+
+double MultiDeviceExecutableNetwork::ExpectedFinishTime(const DeviceName& device) {
+    const auto& statistics = *_deviceStatistics[device];
+    const std::size_t workers = std::max<std::size_t>(_workerRequests[device].size(), 1);
+    const std::size_t idle = std::min(_idleWorkerRequests[device].unsafe_size(), workers);
+    const std::size_t queued = (workers - idle) + statistics._numPendingTasks + statistics._numPendingDeviceSpecificTasks;
+    const double latency = statistics._averageLatency;
+    if (latency <= 0.) {
+        // not measured yet, so the device is the best choice while it has idle requests
+        return queued < workers ? 0. : std::numeric_limits<double>::max();
+    }
+    // each worker request of the device serves the queue in turns
+    return latency * static_cast<double>(queued / workers + 1);
+}
+
+bool MultiDeviceExecutableNetwork::IsWorthStealing(const DeviceName& device, const DeviceName& victim) {
+    // idle request of the device would finish the task earlier than the one it is queued to
+    return !_expectedFinishTimeScheduling ||
+           _deviceStatistics[device]->_averageLatency.load() < ExpectedFinishTime(victim);
+}
+
+bool MultiDeviceExecutableNetwork::HasPendingTasks(const DeviceName& device) {
+    if (_deviceStatistics[device]->_numPendingDeviceSpecificTasks > 0 || _deviceStatistics[device]->_numPendingTasks > 0)
+        return true;
+    return std::any_of(_deviceStatistics.begin(), _deviceStatistics.end(),
+                       [&](const DeviceMap<std::unique_ptr<DeviceStatistics>>::value_type& statistics) {
+                           return statistics.second->_numPendingTasks > 0 && IsWorthStealing(device, statistics.first);
+                       });
+}
+
+bool MultiDeviceExecutableNetwork::PopInferPipelineTask(const DeviceName& device, Task& inferPipelineTask) {
+    auto& statistics = *_deviceStatistics[device];
+    // device specific tasks can not be executed by other devices, so they go first
+    if (_inferPipelineTasksDeviceSpecific[device]->try_pop(inferPipelineTask)) {
+        statistics._numPendingDeviceSpecificTasks--;
+        return true;
+    }
+    if (_inferPipelineTasks[device]->try_pop(inferPipelineTask)) {
+        statistics._numPendingTasks--;
+        return true;
+    }
+    for (auto&& tasks : _inferPipelineTasks) {
+        if (tasks.first != device && IsWorthStealing(device, tasks.first) && tasks.second->try_pop(inferPipelineTask)) {
+            _deviceStatistics[tasks.first]->_numPendingTasks--;
+            statistics._numStolenRequests++;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool MultiDeviceExecutableNetwork::ScheduleQueuedTask(const DeviceName& device) {
+    NotBusyWorkerRequests& idleWorkerRequests = _idleWorkerRequests[device];
+    while (HasPendingTasks(device)) {
+        WorkerInferRequest* workerRequestPtr = nullptr;
+        if (!idleWorkerRequests.try_pop(workerRequestPtr))
+            return false;
+        IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
+        Task inferPipelineTask;
+        if (PopInferPipelineTask(device, inferPipelineTask)) {
+            _thisWorkerInferRequest = workerRequestPtr;
+            {
+                auto capturedTask = std::move(inferPipelineTask);
+                capturedTask();
+            }
+            idleGuard.Release();
+            return true;
+        }
+        // the worker is returned to the idle list, re-check as the pending task might be taken by another worker,
+        // might be counted but not pushed yet, or a new task might be queued while the worker was not visible
+        // to the scheduling thread
+    }
+    return false;
+}
+
+const DeviceName& MultiDeviceExecutableNetwork::SelectDeviceToQueue(const std::vector<DeviceInformation>& devices) {
+    const DeviceName* selected = devices.empty() ? &_inferPipelineTasks.begin()->first : nullptr;
+    if (_expectedFinishTimeScheduling) {
+        // the device with the lowest expected finish time, the first in the priority list on ties
+        double selectedFinishTime = 0.;
+        for (auto&& device : devices) {
+            auto finishTime = ExpectedFinishTime(device.deviceName);
+            if (nullptr == selected || finishTime < selectedFinishTime) {
+                selected = &device.deviceName;
+                selectedFinishTime = finishTime;
+            }
+        }
+        return *selected;
+    }
+    // the device with the least number of pending tasks per worker request, the first in the priority list on ties
+    std::size_t selectedPending = 0, selectedWorkers = 1;
     for (auto&& device : devices) {
-        if (!preferred_device.empty() && (device.deviceName != preferred_device))
+        std::size_t pending = _deviceStatistics[device.deviceName]->_numPendingTasks;
+        std::size_t workers = std::max<std::size_t>(_workerRequests[device.deviceName].size(), 1);
+        if (nullptr == selected || pending * selectedWorkers < selectedPending * workers) {
+            selected = &device.deviceName;
+            selectedPending = pending;
+            selectedWorkers = workers;
+        }
+    }
+    return *selected;
+}
+
+void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipelineTask, DeviceName preferred_device) {
+    auto devices = GetDevicePriorities();
+    // with the expected finish time policy the device-agnostic task is bound to the best device up front,
+    // so a slow device having an idle request does not take it
+    const DeviceName* selectedDevice = &preferred_device;
+    if (preferred_device.empty() && _expectedFinishTimeScheduling && !devices->empty())
+        selectedDevice = &SelectDeviceToQueue(*devices);
+    for (auto&& device : *devices) {
+        if (!selectedDevice->empty() && (device.deviceName != *selectedDevice))
             continue;
         WorkerInferRequest* workerRequestPtr = nullptr;
         NotBusyWorkerRequests& idleWorkerRequests = _idleWorkerRequests[device.deviceName];
@@ -131,10 +258,21 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
         }
     }
     // no vacant requests this time, storing the task to the respective queue
-    if (!preferred_device.empty())
+    // the counters are incremented before the push and decremented after the pop, so they never underflow
+    if (!preferred_device.empty()) {
+        _deviceStatistics[preferred_device]->_numPendingDeviceSpecificTasks++;
         _inferPipelineTasksDeviceSpecific[preferred_device]->push(std::move(inferPipelineTask));
-    else
-        _inferPipelineTasks.push(std::move(inferPipelineTask));
+        ScheduleQueuedTask(preferred_device);
+    } else {
+        const auto& device = selectedDevice->empty() ? SelectDeviceToQueue(*devices) : *selectedDevice;
+        _deviceStatistics[device]->_numPendingTasks++;
+        _inferPipelineTasks[device]->push(std::move(inferPipelineTask));
+        // a worker might become idle after the check above, so it would not see the queued task
+        for (auto&& idleDevice : *devices) {
+            if (ScheduleQueuedTask(idleDevice.deviceName))
+                break;
+        }
+    }
 }
 
 void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
@@ -144,7 +282,7 @@ void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
 MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
     {
         std::lock_guard<std::mutex> lock(_mutex);
-        _devicePriorities.clear();
+        _devicePriorities = std::make_shared<const std::vector<DeviceInformation>>();
     }
     /* NOTE: The only threads that use `MultiDeviceExecutableNetwork` worker infer requests' threads.
      *       But AsyncInferRequest destructor should wait for all asynchronous tasks by the request
@@ -157,13 +295,10 @@ MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
 }
 
 RemoteContext::Ptr MultiDeviceExecutableNetwork::GetContext() const {
-    auto devices = [&] {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _devicePriorities;
-    }();
+    auto devices = GetDevicePriorities();
 
     std::string devices_names;
-    for (auto&& device : devices) {
+    for (auto&& device : *devices) {
         devices_names += device.deviceName + " ";
         const auto& n  = _networksPerDevice.at(device.deviceName);
         try {
@@ -232,7 +367,7 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
                             " device was not in the original device list!";
                 }
             }
-            _devicePriorities = metaDevices;
+            _devicePriorities = std::make_shared<const std::vector<DeviceInformation>>(metaDevices);
 
             // update value in config
             _config[MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = priorities->second;
@@ -273,11 +408,33 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(MULTI_COMPLETED_INFER_REQUESTS),
+            METRIC_KEY(MULTI_STOLEN_INFER_REQUESTS),
+            METRIC_KEY(MULTI_AVERAGE_LATENCY)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else if (name == METRIC_KEY(MULTI_COMPLETED_INFER_REQUESTS)) {
+        std::map<std::string, uint64_t> completedRequests;
+        for (auto&& statistics : _deviceStatistics) {
+            completedRequests[statistics.first] = statistics.second->_numCompletedRequests;
+        }
+        IE_SET_METRIC_RETURN(MULTI_COMPLETED_INFER_REQUESTS, completedRequests);
+    } else if (name == METRIC_KEY(MULTI_STOLEN_INFER_REQUESTS)) {
+        std::map<std::string, uint64_t> stolenRequests;
+        for (auto&& statistics : _deviceStatistics) {
+            stolenRequests[statistics.first] = statistics.second->_numStolenRequests;
+        }
+        IE_SET_METRIC_RETURN(MULTI_STOLEN_INFER_REQUESTS, stolenRequests);
+    } else if (name == METRIC_KEY(MULTI_AVERAGE_LATENCY)) {
+        std::map<std::string, float> averageLatency;
+        for (auto&& statistics : _deviceStatistics) {
+            averageLatency[statistics.first] = static_cast<float>(statistics.second->_averageLatency.load());
+        }
+        IE_SET_METRIC_RETURN(MULTI_AVERAGE_LATENCY, averageLatency);
     } else {
         THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
     }
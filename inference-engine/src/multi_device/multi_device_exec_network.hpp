@@ -6,6 +6,9 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -37,8 +40,6 @@ using DeviceMap = std::unordered_map<DeviceName, T>;
 #if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
 template <typename T>
 using ThreadSafeQueue = tbb::concurrent_queue<T>;
-template <typename T>
-using ThreadSafeBoundedQueue = tbb::concurrent_bounded_queue<T>;
 #else
 template <typename T>
 class ThreadSafeQueue {
@@ -61,38 +62,117 @@ protected:
     std::queue<T>   _queue;
     std::mutex      _mutex;
 };
+#endif
+
+/**
+ * @brief Bounded multi-producer multi-consumer queue which neither allocates nor locks on push and pop
+ *
+ * The capacity is rounded up to the power of two. Each cell keeps a sequence number which tells
+ * producers and consumers whether the cell is free or holds a value for the current lap of the ring.
+ */
 template <typename T>
-class ThreadSafeBoundedQueue {
+class BoundedLockFreeQueue {
 public:
-    ThreadSafeBoundedQueue() = default;
+    BoundedLockFreeQueue() = default;
+    BoundedLockFreeQueue(const BoundedLockFreeQueue&) = delete;
+    BoundedLockFreeQueue& operator=(const BoundedLockFreeQueue&) = delete;
+
+    /**
+     * @brief Allocates the ring. It is not thread-safe unless the capacity is zero,
+     *        the zero capacity makes the queue reject all the following operations
+     */
+    void set_capacity(std::size_t newCapacity) {
+        if (0 == newCapacity) {
+            _closed = true;
+            return;
+        }
+        std::size_t size = 1;
+        while (size < newCapacity) {
+            size <<= 1;
+        }
+        _cells.reset(new Cell[size]);
+        _mask = size - 1;
+        for (std::size_t i = 0; i < size; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+        _enqueuePos.store(0, std::memory_order_relaxed);
+        _dequeuePos.store(0, std::memory_order_relaxed);
+        _closed = false;
+    }
+
     bool try_push(T value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (_capacity) {
-            _queue.push(std::move(value));
+        if (_closed || !_cells) {
+            return false;
+        }
+        Cell* cell = nullptr;
+        auto pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (0 == diff) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // the queue is full
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
         }
-        return _capacity;
+        cell->_value = std::move(value);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
     }
+
+    /**
+     * @brief Returns the number of values in the queue, which is exact only if there are no concurrent operations
+     */
+    std::size_t unsafe_size() const {
+        auto dequeuePos = _dequeuePos.load(std::memory_order_relaxed);
+        auto enqueuePos = _enqueuePos.load(std::memory_order_relaxed);
+        return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+    }
+
     bool try_pop(T& value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (_capacity && !_queue.empty()) {
-            value = std::move(_queue.front());
-            _queue.pop();
-            return true;
-        } else {
+        if (_closed || !_cells) {
             return false;
         }
-    }
-    void set_capacity(std::size_t newCapacity) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        _capacity = newCapacity;
+        Cell* cell = nullptr;
+        auto pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+            if (0 == diff) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // the queue is empty
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->_value);
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
     }
 
 protected:
-    std::queue<T>   _queue;
-    std::mutex      _mutex;
-    bool            _capacity = false;
+    static constexpr std::size_t cacheLineSize = 64;
+    struct Cell {
+        std::atomic<std::size_t>    _sequence;
+        T                           _value;
+    };
+    std::unique_ptr<Cell[]>     _cells;
+    std::size_t                 _mask = 0;
+    std::atomic<bool>           _closed = {false};
+    // producers and consumers update different positions, so keep them in different cache lines
+    std::atomic<std::size_t>    _enqueuePos = {0};
+    char                        _padding[cacheLineSize - sizeof(std::atomic<std::size_t>)];
+    std::atomic<std::size_t>    _dequeuePos = {0};
 };
-#endif
 
 class MultiDeviceExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault,
                                      public InferenceEngine::ITaskExecutor {
@@ -102,8 +182,18 @@ public:
         InferenceEngine::InferRequest   _inferRequest;
         InferenceEngine::Task           _task;
         InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+        std::chrono::steady_clock::time_point _startTime;
+    };
+    using NotBusyWorkerRequests = BoundedLockFreeQueue<WorkerInferRequest*>;
+    using DevicePriorities = std::shared_ptr<const std::vector<DeviceInformation>>;
+    struct DeviceStatistics {
+        std::atomic<std::size_t>    _numPendingTasks = {0};
+        std::atomic<std::size_t>    _numPendingDeviceSpecificTasks = {0};
+        std::atomic<std::uint64_t>  _numCompletedRequests = {0};
+        std::atomic<std::uint64_t>  _numStolenRequests = {0};
+        // exponentially weighted moving average of the inference latency in milliseconds, zero until measured
+        std::atomic<double>         _averageLatency = {0.};
     };
-    using NotBusyWorkerRequests = ThreadSafeBoundedQueue<WorkerInferRequest*>;
 
     explicit MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                  networksPerDevice,
                                           const std::vector<DeviceInformation>&                                 networkDevices,
@@ -121,6 +211,14 @@ public:
     ~MultiDeviceExecutableNetwork() override;
 
     void ScheduleToWorkerInferRequest(InferenceEngine::Task, DeviceName preferred_device = "");
+    DevicePriorities GetDevicePriorities() const;
+    bool ScheduleQueuedTask(const DeviceName& device);
+    bool HasPendingTasks(const DeviceName& device);
+    bool PopInferPipelineTask(const DeviceName& device, InferenceEngine::Task& inferPipelineTask);
+    const DeviceName& SelectDeviceToQueue(const std::vector<DeviceInformation>& devices);
+    double ExpectedFinishTime(const DeviceName& device);
+    bool IsWorthStealing(const DeviceName& device, const DeviceName& victim);
+    void UpdateAverageLatency(DeviceStatistics& statistics, double latency);
 
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
     // have to use the const char* ptr rather than std::string due to a bug in old gcc versions,
@@ -128,15 +226,18 @@ public:
     // https://gcc.gnu.org/bugzilla/show_bug.cgi?id=81880
     static thread_local const char*                             _thisPreferredDeviceName;
     mutable std::mutex                                          _mutex;
-    std::vector<DeviceInformation>                              _devicePriorities;
+    DevicePriorities                                            _devicePriorities;
     const std::vector<DeviceInformation>                        _devicePrioritiesInitial;
     DeviceMap<InferenceEngine::ExecutableNetwork>               _networksPerDevice;
-    ThreadSafeQueue<InferenceEngine::Task>                      _inferPipelineTasks;
+    // device-agnostic tasks queued to the device, idle workers of other devices may steal them
+    DeviceMap<std::unique_ptr<ThreadSafeQueue<InferenceEngine::Task>>> _inferPipelineTasks;
     DeviceMap<std::unique_ptr<ThreadSafeQueue<InferenceEngine::Task>>> _inferPipelineTasksDeviceSpecific;
+    DeviceMap<std::unique_ptr<DeviceStatistics>>                _deviceStatistics;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
+    bool                                                        _expectedFinishTimeScheduling = false;
     std::atomic_size_t                                          _numRequestsCreated = {0};
 };
 
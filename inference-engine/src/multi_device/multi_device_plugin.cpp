@@ -109,6 +109,9 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetConfig(const std::stri
         } else {
             return { it->second };
         }
+    } else if (name == MULTI_CONFIG_KEY(SCHEDULING_POLICY)) {
+        auto it = _config.find(MULTI_CONFIG_KEY(SCHEDULING_POLICY));
+        return { it == _config.end() ? std::string{MultiDeviceConfigParams::MULTI_PRIORITY_ORDER} : it->second };
     } else {
         THROW_IE_EXCEPTION << "Unsupported config key: " << name;
     }
@@ -141,6 +144,7 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetMetric(const std::stri
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys = {
             MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+            MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
             CONFIG_KEY_INTERNAL(AGGREGATED_PLUGIN)};
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
@@ -164,11 +168,25 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
         THROW_IE_EXCEPTION << "KEY_MULTI_DEVICE_PRIORITIES key is not set for MULTI device";
     }
 
+    std::string schedulingPolicy = MultiDeviceConfigParams::MULTI_PRIORITY_ORDER;
+    auto itSchedulingPolicy = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (itSchedulingPolicy != fullConfig.end()) {
+        schedulingPolicy = itSchedulingPolicy->second;
+        if (schedulingPolicy != MultiDeviceConfigParams::MULTI_PRIORITY_ORDER &&
+            schedulingPolicy != MultiDeviceConfigParams::MULTI_EXPECTED_FINISH_TIME) {
+            THROW_IE_EXCEPTION << "Wrong value " << schedulingPolicy << " for property key "
+                               << MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY << ". Expected only "
+                               << MultiDeviceConfigParams::MULTI_PRIORITY_ORDER << " or "
+                               << MultiDeviceConfigParams::MULTI_EXPECTED_FINISH_TIME;
+        }
+    }
+
     auto metaDevices = ParseMetaDevices(priorities->second, fullConfig);
 
     // collect the settings that are applicable to the devices we are loading the network to
     std::unordered_map<std::string, InferenceEngine::Parameter> multiNetworkConfig;
     multiNetworkConfig.insert(*priorities);
+    multiNetworkConfig.insert({MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, schedulingPolicy});
 
     DeviceMap<ExecutableNetwork> executableNetworkPerDevice;
     std::mutex load_mutex;
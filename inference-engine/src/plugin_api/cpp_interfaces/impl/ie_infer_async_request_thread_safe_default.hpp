@@ -13,6 +13,8 @@
 #include <cpp_interfaces/exception2status.hpp>
 #include <ie_system_conf.h>
 
+#include <algorithm>
+#include <condition_variable>
 #include <exception>
 #include <future>
 #include <map>
@@ -34,6 +36,8 @@ namespace InferenceEngine {
  *        The class is recommended to be used by plugins as a base class for asynchronous inference request implementation.
  * @note  To synchronize derived context with stages
  *        derived class should call AsyncInferRequestThreadSafeDefault::StopAndWait() function in destructor.
+ * @note  The pipeline state lives in the request, so starting the pipeline and waiting for it do not allocate memory
+ *        as long as stage executors do not.
  * @par Example
  *        Here is an example of asynchronous inference request implementation for some accelerator device.
  *        It uses 5 different executors to run different stages of a synchronous inference request.
@@ -42,8 +46,6 @@ namespace InferenceEngine {
  */
 class AsyncInferRequestThreadSafeDefault : public IAsyncInferRequestInternal {
     enum InferState {Idle, Busy, Canceled, Stop};
-    using Futures = std::vector<std::shared_future<void>>;
-    using Promise = std::shared_ptr<std::promise<void>>;
     enum Stage_e : std::uint8_t { executor, task };
     InferRequestInternal::Ptr _syncRequest;
 
@@ -72,6 +74,7 @@ class AsyncInferRequestThreadSafeDefault : public IAsyncInferRequestInternal {
     void InferImpl(const F& f) {
         _syncRequest->checkBlobs();
         InferState state = InferState::Idle;
+        std::size_t pipelineId = 0;
         {
             std::lock_guard<std::mutex> lock{_mutex};
             state = _state;
@@ -81,18 +84,8 @@ class AsyncInferRequestThreadSafeDefault : public IAsyncInferRequestInternal {
             case InferState::Canceled :
                 THROW_IE_EXCEPTION_WITH_STATUS(INFER_CANCELLED);
             case InferState::Idle : {
-                _futures.erase(std::remove_if(std::begin(_futures), std::end(_futures),
-                                                [](const std::shared_future<void>& future) {
-                                                    if (future.valid()) {
-                                                        return (std::future_status::ready ==
-                                                                future.wait_for(std::chrono::milliseconds {0}));
-                                                    } else {
-                                                        return true;
-                                                    }
-                                                }),
-                                _futures.end());
-                _promise = {};
-                _futures.emplace_back(_promise.get_future().share());
+                pipelineId = _pipelineId = ++_startedPipelines;
+                _runningPipelines.push_back(pipelineId);
             } break;
             case InferState::Stop : break;
             }
@@ -102,9 +95,11 @@ class AsyncInferRequestThreadSafeDefault : public IAsyncInferRequestInternal {
             try {
                 f();
             } catch (...) {
-                _promise.set_exception(std::current_exception());
-                std::lock_guard<std::mutex> lock{_mutex};
-                _state = InferState::Idle;
+                {
+                    std::lock_guard<std::mutex> lock{_mutex};
+                    _state = InferState::Idle;
+                }
+                FinishPipeline(pipelineId, std::current_exception());
                 throw;
             }
         }
@@ -147,11 +142,15 @@ public:
         _requestExecutor {taskExecutor},
         _callbackExecutor {callbackExecutor},
         _pipeline {{taskExecutor, [this] {_syncRequest->InferImpl();}}},
-        _syncPipeline {{std::make_shared<ImmediateExecutor>(), [this] {_syncRequest->InferImpl();}}} {
+        _syncPipeline {{std::make_shared<ImmediateExecutor>(), [this] {_syncRequest->InferImpl();}}},
+        _stageTask {[this] {RunStage();}},
+        _lastStageTask {[this] {RunLastStage();}} {
         auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(taskExecutor);
         if (streamsExecutor != nullptr) {
             _syncPipeline = {{std::make_shared<ImmediateStreamsExecutor>(std::move(streamsExecutor)), [this] {_syncRequest->InferImpl();}}};
         }
+        // the callback may start the next pipeline before the previous one is finished
+        _runningPipelines.reserve(2);
     }
 
     /**
@@ -173,37 +172,40 @@ public:
                 << " Timeout can't be less "
                 << IInferRequest::WaitMode::RESULT_READY << " for InferRequest::Wait\n";
         }
-        auto status = std::future_status::deferred;
-
-        // Just use the last '_futures' member to wait pipeline completion
-        auto future = [&] {
-            std::lock_guard<std::mutex> lock {_mutex};
-            return _futures.empty() ? std::shared_future<void> {} : _futures.back();
-        }();
+        std::exception_ptr exception = nullptr;
+        {
+            std::unique_lock<std::mutex> lock {_mutex};
+            // Just wait for the last started pipeline
+            const auto pipelineId = _startedPipelines;
+            if (0 == pipelineId) {
+                return StatusCode::INFER_NOT_STARTED;
+            }
 
-        if (!future.valid()) {
-            return StatusCode::INFER_NOT_STARTED;
-        }
+            auto isReady = [&] {return _finishedPipeline >= pipelineId;};
+            bool ready = false;
+            switch (millis_timeout) {
+            case IInferRequest::WaitMode::RESULT_READY: {
+                _pipelineFinished.wait(lock, isReady);
+                ready = true;
+            } break;
+            case IInferRequest::WaitMode::STATUS_ONLY: {
+                ready = isReady();
+            } break;
+            default: {
+                ready = _pipelineFinished.wait_for(lock, std::chrono::milliseconds {millis_timeout}, isReady);
+            } break;
+            }
 
-        switch (millis_timeout) {
-        case IInferRequest::WaitMode::RESULT_READY: {
-            future.wait();
-            status = std::future_status::ready;
-        } break;
-        case IInferRequest::WaitMode::STATUS_ONLY: {
-            status = future.wait_for(std::chrono::milliseconds {0});
-        } break;
-        default: {
-            status = future.wait_for(std::chrono::milliseconds {millis_timeout});
-        } break;
+            if (!ready) {
+                return StatusCode::RESULT_NOT_READY;
+            }
+            exception = _pipelineException;
         }
 
-        if (std::future_status::ready == status) {
-            future.get();
-            return StatusCode::OK;
-        } else {
-            return StatusCode::RESULT_NOT_READY;
+        if (nullptr != exception) {
+            std::rethrow_exception(exception);
         }
+        return StatusCode::OK;
     }
 
     void StartAsync() override {
@@ -299,9 +301,8 @@ protected:
     using Pipeline = std::vector<Stage>;
 
     /**
-     * @brief Creates and run the first stage task. If destructor was not called add a new std::future to the
-     * AsyncInferRequestThreadSafeDefault::_futures list that would be used to wait
-     * AsyncInferRequestThreadSafeDefault::_pipeline finish
+     * @brief Runs the first stage task. The pipeline position is kept in the request, so tasks passed to
+     * stage executors do not allocate memory
      * @param[in]  itBeginStage Iterator to begin of pipeline
      * @param[in]  itEndStage End pipeline iterator
      * @param[in]  callbackExecutor Final or error stage executor
@@ -310,7 +311,10 @@ protected:
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
         auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
         IE_ASSERT(nullptr != firstStageExecutor);
-        firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
+        _itStage = itBeginStage;
+        _itEndStage = itEndStage;
+        _stageCallbackExecutor = std::move(callbackExecutor);
+        firstStageExecutor->run(_stageTask);
     }
 
     /**
@@ -320,22 +324,10 @@ protected:
      */
     void StopAndWait() {
         _callback = nullptr;
-        Futures futures;
-        InferState state = InferState::Idle;
-        {
-            std::lock_guard<std::mutex> lock{_mutex};
-            state = _state;
-            if (state != InferState::Stop) {
-                _state = InferState::Stop;
-                futures = std::move(_futures);
-            }
-        }
-        if (state != InferState::Stop) {
-            for (auto&& future : futures) {
-                if (future.valid()) {
-                    future.wait();
-                }
-            }
+        std::unique_lock<std::mutex> lock{_mutex};
+        if (_state != InferState::Stop) {
+            _state = InferState::Stop;
+            _pipelineFinished.wait(lock, [&] {return _runningPipelines.empty();});
         }
     }
 
@@ -371,83 +363,112 @@ protected:
 
 private:
     /**
-     * @brief Create a task with next pipeline stage.
-     * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
-     * On last stage or if the exception is raised from `_pipeline` task
-     * the last stage task is called or passed to callback executor if it is presented. The last stage task call the
-     * callback, if it is presented, capture the `_promise` member and use it to forward completion or exception to the
-     * one of `_futures` member
-     * @param[in]  itStage Iterator to next stage of pipeline
-     * @param[in]  itEndStage End pipeline iterator
-     * @param[in]  callbackExecutor Executor that will run final stage with callback call
-     * @return A next stage task
+     * @brief Runs the current stage of the pipeline and passes AsyncInferRequestThreadSafeDefault::_stageTask to
+     * the executor of the next stage. Only one pipeline runs at a time, so stages share the request members.
+     * On last stage or if the exception is raised from `_pipeline` task the last stage task is called or
+     * passed to callback executor if it is presented.
      */
-    Task MakeNextStageTask(const Pipeline::iterator itStage, const Pipeline::iterator itEndStage,
-                           const ITaskExecutor::Ptr callbackExecutor) {
-        return std::bind([this, itStage, itEndStage](ITaskExecutor::Ptr& callbackExecutor) mutable {
-            StatusCode requestStatus = StatusCode::OK;
-            std::exception_ptr localCurrentException = nullptr;
-            auto& thisStage = *itStage;
-            auto itNextStage = itStage + 1;
+    void RunStage() {
+        StatusCode requestStatus = StatusCode::OK;
+        std::exception_ptr localCurrentException = nullptr;
+        const auto itStage = _itStage;
+        const auto itEndStage = _itEndStage;
+        const auto itNextStage = itStage + 1;
+        auto callbackExecutor = _stageCallbackExecutor;
+
+        try {
+            auto& stageTask = std::get<Stage_e::task>(*itStage);
+            IE_ASSERT(nullptr != stageTask);
+            stageTask();
+            if (itEndStage != itNextStage) {
+                auto& nextStageExecutor = std::get<Stage_e::executor>(*itNextStage);
+                IE_ASSERT(nullptr != nextStageExecutor);
+                _itStage = itNextStage;
+                nextStageExecutor->run(_stageTask);
+            }
+        } catch (InferenceEngine::details::InferenceEngineException& ie_ex) {
+            requestStatus = ie_ex.hasStatus() ? ie_ex.getStatus() : StatusCode::GENERAL_ERROR;
+            localCurrentException = std::make_exception_ptr(ie_ex);
+        } catch (...) {
+            requestStatus = StatusCode::GENERAL_ERROR;
+            localCurrentException = std::current_exception();
+        }
+
+        if ((itEndStage == itNextStage) || (nullptr != localCurrentException)) {
+            _requestStatus = requestStatus;
+            _stageException = localCurrentException;
+            if (nullptr == callbackExecutor) {
+                RunLastStage();
+            } else {
+                callbackExecutor->run(_lastStageTask);
+            }
+        }
+    }
 
+    /**
+     * @brief The last stage task calls the callback, if it is presented, and forwards completion or exception
+     * to AsyncInferRequestThreadSafeDefault::Wait()
+     */
+    void RunLastStage() {
+        auto requestStatus = _requestStatus;
+        auto localCurrentException = std::move(_stageException);
+        std::size_t pipelineId = 0;
+        IInferRequest::CompletionCallback callback = nullptr;
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _state = InferState::Idle;
+            pipelineId = _pipelineId;
+            callback = _callback;
+        }
+        if (nullptr != callback) {
+            InferenceEngine::CurrentException() = localCurrentException;
             try {
-                auto& stageTask = std::get<Stage_e::task>(thisStage);
-                IE_ASSERT(nullptr != stageTask);
-                stageTask();
-               if (itEndStage != itNextStage) {
-                    auto& nextStage = *itNextStage;
-                    auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
-                    IE_ASSERT(nullptr != nextStageExecutor);
-                    nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
-                }
-            } catch (InferenceEngine::details::InferenceEngineException& ie_ex) {
-                requestStatus = ie_ex.hasStatus() ? ie_ex.getStatus() : StatusCode::GENERAL_ERROR;
-                localCurrentException = std::make_exception_ptr(ie_ex);
+                callback(_publicInterface, requestStatus);
             } catch (...) {
-                requestStatus = StatusCode::GENERAL_ERROR;
                 localCurrentException = std::current_exception();
             }
+            InferenceEngine::CurrentException() = nullptr;
+        }
+        FinishPipeline(pipelineId, std::move(localCurrentException));
+    }
 
-            if ((itEndStage == itNextStage) || (nullptr != localCurrentException)) {
-                auto lastStageTask = [this, requestStatus, localCurrentException]() mutable {
-                    auto promise = std::move(_promise);
-                    IInferRequest::CompletionCallback callback = nullptr;
-                    {
-                        std::lock_guard<std::mutex> lock{_mutex};
-                        _state = InferState::Idle;
-                        callback = _callback;
-                    }
-                    if (nullptr != callback) {
-                        InferenceEngine::CurrentException() = localCurrentException;
-                        try {
-                            callback(_publicInterface, requestStatus);
-                        } catch (...) {
-                            localCurrentException = std::current_exception();
-                        }
-                        InferenceEngine::CurrentException() = nullptr;
-                    }
-                    if (nullptr == localCurrentException) {
-                        promise.set_value();
-                    } else {
-                        promise.set_exception(localCurrentException);
-                    }
-                };
-
-                if (nullptr == callbackExecutor) {
-                    lastStageTask();
-                } else {
-                    callbackExecutor->run(std::move(lastStageTask));
-                }
+    void FinishPipeline(const std::size_t pipelineId, std::exception_ptr exception) {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            // A pipeline which throws on start after its first stage was passed to the executor is finished
+            // by the failed start and by its stages, only the first of them counts
+            auto itPipeline = std::find(_runningPipelines.begin(), _runningPipelines.end(), pipelineId);
+            if (itPipeline == _runningPipelines.end()) {
+                return;
             }
-        }, std::move(callbackExecutor));
+            _runningPipelines.erase(itPipeline);
+            // the callback may start the next pipeline that finishes first
+            if (pipelineId > _finishedPipeline) {
+                _finishedPipeline = pipelineId;
+                _pipelineException = std::move(exception);
+            }
+            // notified under the lock as StopAndWait() may destroy the request right after the wake-up
+            _pipelineFinished.notify_all();
+        }
     }
 
     void* _userData = nullptr;
     IInferRequest::CompletionCallback _callback = nullptr;
     IInferRequest::Ptr _publicInterface;
-    std::promise<void> _promise;
+    Task _stageTask;
+    Task _lastStageTask;
+    Pipeline::iterator _itStage;
+    Pipeline::iterator _itEndStage;
+    ITaskExecutor::Ptr _stageCallbackExecutor;
+    StatusCode _requestStatus = StatusCode::OK;
+    std::exception_ptr _stageException = nullptr;
     mutable std::mutex _mutex;
-    Futures _futures;
+    std::condition_variable _pipelineFinished;
+    std::size_t _pipelineId = 0;
+    std::size_t _startedPipelines = 0;
+    std::size_t _finishedPipeline = 0;
+    std::vector<std::size_t> _runningPipelines;
+    std::exception_ptr _pipelineException = nullptr;
     InferState _state = InferState::Idle;
 };
 }  // namespace InferenceEngine
@@ -38,6 +38,13 @@ DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
  */
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
+/**
+ * @brief Number of attempts an idle CPU Executor Stream makes to pick up a task before its thread is parked.
+ *        Spinning trades CPU time for lower dispatch latency, 0 (default) parks threads right away
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_STREAM_SPIN_COUNT);
+
 /**
  * @brief This key should be used to notify aggregating plugin
  *        that it is used inside other aggregating plugin
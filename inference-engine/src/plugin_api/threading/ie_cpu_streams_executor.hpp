@@ -20,7 +20,9 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from lock-free per-stream queues. A stream thread with an empty
+ *        queue steals tasks from queues of other streams, the streams of its NUMA node first, and parks after
+ *        IStreamsExecutor::Config::_spinCount unsuccessful attempts.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -29,6 +31,17 @@ public:
      */
     using Ptr = std::shared_ptr<CPUStreamsExecutor>;
 
+    /**
+     * @brief Task queue counters used to tune the number of streams and spinning
+     */
+    struct Counters {
+        std::size_t queued = 0;     //!< Number of tasks waiting in queues
+        std::size_t maxQueued = 0;  //!< Maximal number of tasks that were waiting in queues at once
+        std::size_t enqueued = 0;   //!< Total number of tasks passed to run()
+        std::size_t stolen = 0;     //!< Number of tasks taken by a stream from a queue of other stream
+        std::size_t parks = 0;      //!< Number of times stream threads found no tasks and were parked
+    };
+
     /**
     * @brief Constructor
     * @param config Stream executor parameters
@@ -44,10 +57,24 @@ public:
 
     void Execute(Task task) override;
 
+    /**
+     * @brief Queues the task to the streams of the NUMA node. Other streams do not take it,
+     *        unless the executor has no streams on the node
+     * @param numaNodeId `ID` of the NUMA node
+     * @param task A task to start
+     */
+    void RunOnNumaNode(int numaNodeId, Task task) override;
+
     int GetStreamId() override;
 
     int GetNumaNodeId() override;
 
+    /**
+     * @brief Returns task queue counters accumulated since the executor creation
+     * @return Counters snapshot
+     */
+    Counters GetCounters() const;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
@@ -83,6 +83,7 @@ public:
         int                _threadBindingStep       = 1;  //!< In case of @ref CORES binding offset type thread binded to cores with defined step
         int                _threadBindingOffset     = 0;  //!< In case of @ref CORES binding offset type thread binded to cores starting from offset
         int                _threads                 = 0;  //!< Number of threads distributed between streams. Reserved. Should not be used.
+        int                _spinCount               = 0;  //!< Number of attempts an idle stream thread makes to find a task before it parks
 
         /**
          * @brief      A constructor with arguments
@@ -135,6 +136,14 @@ public:
     * @param task A task to start
     */
     virtual void Execute(Task task) = 0;
+
+    /**
+    * @brief Starts the task on a stream bound to the NUMA node, so the memory the task allocates and touches first
+    *        is placed on the node. By default, the task is started with run()
+    * @param numaNodeId `ID` of the NUMA node
+    * @param task A task to start
+    */
+    virtual void RunOnNumaNode(int numaNodeId, Task task);
 };
 
 
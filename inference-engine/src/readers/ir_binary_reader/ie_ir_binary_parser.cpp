@@ -0,0 +1,471 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_ir_binary_parser.hpp"
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/op/loop.hpp>
+#include <ngraph/op/util/sub_graph_base.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
+#include <ngraph/variant.hpp>
+#include <transformations/serialize_binary.hpp>
+
+#include "ie_ir_binary_itt.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+using Header = ngraph::pass::SerializeBinary::Header;
+using Tag = ngraph::pass::SerializeBinary::Tag;
+using Description = ngraph::pass::SerializeBinary::Description;
+
+// Reads values written by the binary serializer, every read is checked against the end of the data
+class BinaryStream {
+public:
+    BinaryStream() = default;
+    BinaryStream(const char* begin, const char* end): m_pos(begin), m_end(end) {}
+
+    template <typename T>
+    T read() {
+        check(sizeof(T));
+        T value;
+        std::memcpy(&value, m_pos, sizeof(T));
+        m_pos += sizeof(T);
+        return value;
+    }
+
+    std::string read_string() {
+        const auto size = read<uint32_t>();
+        return std::string(skip(size), size);
+    }
+
+    template <typename T>
+    std::vector<T> read_vector() {
+        const auto count = read<uint64_t>();
+        if (count > static_cast<uint64_t>(m_end - m_pos) / sizeof(T))
+            THROW_IE_EXCEPTION << "Binary IR is corrupted: unexpected end of data";
+        std::vector<T> values(count);
+        if (count)
+            std::memcpy(values.data(), skip(count * sizeof(T)), count * sizeof(T));
+        return values;
+    }
+
+    // Reads the number of elements which follow, each of them takes at least `min_size` bytes, so a corrupted
+    // count is reported before the elements are allocated
+    template <typename T>
+    T read_count(uint64_t min_size) {
+        const auto count = read<T>();
+        if (count > static_cast<uint64_t>(m_end - m_pos) / min_size)
+            THROW_IE_EXCEPTION << "Binary IR is corrupted: unexpected end of data";
+        return count;
+    }
+
+    std::vector<std::string> read_strings() {
+        const auto count = read_count<uint64_t>(sizeof(uint32_t));
+        std::vector<std::string> values;
+        for (uint64_t i = 0; i < count; ++i) {
+            values.push_back(read_string());
+        }
+        return values;
+    }
+
+    const char* skip(uint64_t size) {
+        check(size);
+        const auto begin = m_pos;
+        m_pos += size;
+        return begin;
+    }
+
+private:
+    void check(uint64_t size) const {
+        if (size > static_cast<uint64_t>(m_end - m_pos))
+            THROW_IE_EXCEPTION << "Binary IR is corrupted: unexpected end of data";
+    }
+
+    const char* m_pos = nullptr;
+    const char* m_end = nullptr;
+};
+
+using Attributes = std::unordered_map<std::string, std::pair<Tag, BinaryStream>>;
+
+class FunctionParser {
+public:
+    FunctionParser(const Blob::CPtr& model, const Header& header,
+                   const std::unordered_map<std::string, ngraph::OpSet>& opsets,
+                   std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& variables)
+        : model(model), header(header), opsets(opsets), variables(variables) {}
+
+    std::shared_ptr<ngraph::Function> parse(BinaryStream& in);
+
+    std::shared_ptr<ngraph::runtime::AlignedBuffer> get_buffer(uint64_t offset, uint64_t size) const {
+        if (offset > header.weights_size || size > header.weights_size - offset)
+            THROW_IE_EXCEPTION << "Binary IR is corrupted: constant is out of the weights section";
+        char* data = model->cbuffer().as<char*>() + header.weights_offset + offset;
+
+        // Constants refer to the model blob, which is usually the mapped model file
+        using SharedBuffer = ngraph::runtime::SharedBuffer<const Blob::CPtr>;
+        return std::make_shared<SharedBuffer>(data, size, model);
+    }
+
+    std::shared_ptr<ngraph::Variable> get_variable(const std::string& variable_id) {
+        auto& variable = variables[variable_id];
+        if (!variable) {
+            variable = std::make_shared<ngraph::Variable>(ngraph::VariableInfo{
+                ngraph::PartialShape::dynamic(), ngraph::element::dynamic, variable_id});
+        }
+        return variable;
+    }
+
+private:
+    std::shared_ptr<ngraph::Node> createNode(const std::string& type, uint64_t version, const std::string& opset,
+                                             const ngraph::OutputVector& inputs, const Attributes& attributes);
+
+    const Blob::CPtr& model;
+    const Header& header;
+    const std::unordered_map<std::string, ngraph::OpSet>& opsets;
+    std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& variables;
+};
+
+class BinaryDeserializer : public ngraph::AttributeVisitor {
+public:
+    BinaryDeserializer(const Attributes& attributes, FunctionParser& parser)
+        : attributes(attributes), parser(parser) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        using InputDescription = ngraph::op::util::SubGraphOp::InputDescription;
+        using OutputDescription = ngraph::op::util::SubGraphOp::OutputDescription;
+        BinaryStream value;
+        if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+                &adapter)) {
+            if (!find(name, Tag::BUFFER, value)) return;
+            const auto offset = value.read<uint64_t>();
+            a->set(parser.get_buffer(offset, value.read<uint64_t>()));
+        } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+            if (!find(name, Tag::VARIABLE, value)) return;
+            a->set(parser.get_variable(value.read_string()));
+        } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::vector<std::shared_ptr<InputDescription>>>>(
+                &adapter)) {
+            if (!find(name, Tag::INPUT_DESCRIPTIONS, value)) return;
+            // the invariant input description is the shortest one
+            std::vector<std::shared_ptr<InputDescription>> descriptions(
+                value.read_count<uint64_t>(sizeof(Description) + 2 * sizeof(uint64_t)));
+            for (auto& description : descriptions) {
+                const auto kind = value.read<Description>();
+                if (kind == Description::SLICE_INPUT) {
+                    const auto slice = value.read<std::array<int64_t, 5>>();
+                    const auto input_index = value.read<uint64_t>();
+                    description = std::make_shared<ngraph::op::util::SubGraphOp::SliceInputDescription>(
+                        input_index, value.read<uint64_t>(), slice[0], slice[1], slice[2], slice[3], slice[4]);
+                } else if (kind == Description::MERGED_INPUT) {
+                    const auto body_value_index = value.read<uint64_t>();
+                    const auto input_index = value.read<uint64_t>();
+                    description = std::make_shared<ngraph::op::util::SubGraphOp::MergedInputDescription>(
+                        input_index, value.read<uint64_t>(), body_value_index);
+                } else if (kind == Description::INVARIANT_INPUT) {
+                    const auto input_index = value.read<uint64_t>();
+                    description = std::make_shared<ngraph::op::util::SubGraphOp::InvariantInputDescription>(
+                        input_index, value.read<uint64_t>());
+                } else {
+                    THROW_IE_EXCEPTION << "Binary IR is corrupted: unknown input description of " << name;
+                }
+            }
+            a->set(descriptions);
+        } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::vector<std::shared_ptr<OutputDescription>>>>(
+                &adapter)) {
+            if (!find(name, Tag::OUTPUT_DESCRIPTIONS, value)) return;
+            // the body output description is the shortest one
+            std::vector<std::shared_ptr<OutputDescription>> descriptions(
+                value.read_count<uint64_t>(sizeof(Description) + sizeof(int64_t) + 2 * sizeof(uint64_t)));
+            for (auto& description : descriptions) {
+                const auto kind = value.read<Description>();
+                if (kind == Description::CONCAT_OUTPUT) {
+                    const auto concat = value.read<std::array<int64_t, 5>>();
+                    const auto body_value_index = value.read<uint64_t>();
+                    description = std::make_shared<ngraph::op::util::SubGraphOp::ConcatOutputDescription>(
+                        body_value_index, value.read<uint64_t>(), concat[0], concat[1], concat[2], concat[3], concat[4]);
+                } else if (kind == Description::BODY_OUTPUT) {
+                    const auto iteration = value.read<int64_t>();
+                    const auto body_value_index = value.read<uint64_t>();
+                    description = std::make_shared<ngraph::op::util::SubGraphOp::BodyOutputDescription>(
+                        body_value_index, value.read<uint64_t>(), iteration);
+                } else {
+                    THROW_IE_EXCEPTION << "Binary IR is corrupted: unknown output description of " << name;
+                }
+            }
+            a->set(descriptions);
+        } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::v5::Loop::SpecialBodyPorts>>(
+                &adapter)) {
+            if (!find(name, Tag::SPECIAL_BODY_PORTS, value)) return;
+            const auto ports = value.read<std::array<int64_t, 2>>();
+            a->set(ngraph::op::v5::Loop::SpecialBodyPorts(ports[0], ports[1]));
+        }
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        BinaryStream value;
+        if (find(name, Tag::BOOL, value))
+            adapter.set(value.read<uint8_t>() != 0);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        BinaryStream value;
+        if (find(name, Tag::STRING, value))
+            adapter.set(value.read_string());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        read_value<int64_t>(name, Tag::INT64, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        read_value<double>(name, Tag::DOUBLE, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        read_vector<int8_t>(name, Tag::VEC_INT8, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        read_vector<int16_t>(name, Tag::VEC_INT16, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        read_vector<int32_t>(name, Tag::VEC_INT32, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        read_vector<int64_t>(name, Tag::VEC_INT64, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        read_vector<uint8_t>(name, Tag::VEC_UINT8, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        read_vector<uint16_t>(name, Tag::VEC_UINT16, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        read_vector<uint32_t>(name, Tag::VEC_UINT32, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        read_vector<uint64_t>(name, Tag::VEC_UINT64, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        read_vector<float>(name, Tag::VEC_FLOAT, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        read_vector<double>(name, Tag::VEC_DOUBLE, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        BinaryStream value;
+        if (find(name, Tag::VEC_STRING, value))
+            adapter.set(value.read_strings());
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override {
+        BinaryStream value;
+        if (find(name, Tag::FUNCTION, value))
+            adapter.set(parser.parse(value));
+    }
+
+private:
+    // Attributes which are not stored keep the default values of the operation
+    bool find(const std::string& name, Tag tag, BinaryStream& value) const {
+        auto found = attributes.find(name);
+        if (found == attributes.end())
+            return false;
+        if (found->second.first != tag)
+            THROW_IE_EXCEPTION << "Binary IR is corrupted: attribute " << name << " has unexpected type";
+        value = found->second.second;
+        return true;
+    }
+
+    template <typename T, typename Adapter>
+    void read_value(const std::string& name, Tag tag, Adapter& adapter) const {
+        BinaryStream value;
+        if (find(name, tag, value))
+            adapter.set(value.read<T>());
+    }
+
+    template <typename T, typename Adapter>
+    void read_vector(const std::string& name, Tag tag, Adapter& adapter) const {
+        BinaryStream value;
+        if (find(name, tag, value))
+            adapter.set(value.read_vector<T>());
+    }
+
+    const Attributes& attributes;
+    FunctionParser& parser;
+};
+
+std::shared_ptr<ngraph::Node> FunctionParser::createNode(const std::string& type, uint64_t version,
+                                                         const std::string& opset,
+                                                         const ngraph::OutputVector& inputs,
+                                                         const Attributes& attributes) {
+    auto opsetIt = opsets.find(opset);
+    if (opsetIt == opsets.end())
+        THROW_IE_EXCEPTION << "Cannot create " << type << " layer from unsupported opset: " << opset;
+
+    auto node = std::shared_ptr<ngraph::Node>(opsetIt->second.create_insensitive(type));
+    if (!node || node->get_type_info().version != version)
+        THROW_IE_EXCEPTION << "Opset " << opset << " doesn't contain the operation with type: " << type
+                           << " of version " << version;
+
+    // Share Weights form the model blob
+    if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(node)) {
+        constant->alloc_buffer_on_visit_attributes(false);
+    }
+    node->set_arguments(inputs);
+    BinaryDeserializer visitor(attributes, *this);
+    if (node->visit_attributes(visitor) && std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(node)) {
+        node->constructor_validate_and_infer_types();
+    }
+
+    // To be sure that all default values will be initialized:
+    return node->clone_with_new_inputs(node->input_values());
+}
+
+std::shared_ptr<ngraph::Function> FunctionParser::parse(BinaryStream& in) {
+    const auto name = in.read_string();
+    const auto count = in.read<uint32_t>();
+
+    std::vector<std::shared_ptr<ngraph::Node>> nodes;
+    auto get_node = [&](uint32_t index) -> const std::shared_ptr<ngraph::Node>& {
+        // nodes are stored in topological order, so only already created nodes can be referred
+        if (index >= nodes.size())
+            THROW_IE_EXCEPTION << "Binary IR is corrupted: node " << nodes.size() << " refers to node " << index;
+        return nodes[index];
+    };
+
+    for (uint32_t i = 0; i < count; ++i) {
+        const auto type = in.read_string();
+        const auto version = in.read<uint64_t>();
+        const auto opset = in.read_string();
+        const auto friendly_name = in.read_string();
+
+        // an input is the index of the source node and of its output
+        ngraph::OutputVector inputs(in.read_count<uint32_t>(2 * sizeof(uint32_t)));
+        for (auto& input : inputs) {
+            const auto& source = get_node(in.read<uint32_t>());
+            const auto index = in.read<uint32_t>();
+            if (index >= source->get_output_size())
+                THROW_IE_EXCEPTION << "Binary IR is corrupted: " << type << " layer " << friendly_name
+                                   << " has incorrect input";
+            input = source->output(index);
+        }
+
+        std::vector<std::shared_ptr<ngraph::Node>> control_dependencies(in.read_count<uint32_t>(sizeof(uint32_t)));
+        for (auto& control_dependency : control_dependencies) {
+            control_dependency = get_node(in.read<uint32_t>());
+        }
+
+        std::vector<std::vector<std::string>> tensor_names(in.read_count<uint32_t>(sizeof(uint64_t)));
+        for (auto& names : tensor_names) {
+            names = in.read_strings();
+        }
+
+        Attributes attributes;
+        const auto attributes_count = in.read<uint32_t>();
+        for (uint32_t j = 0; j < attributes_count; ++j) {
+            auto attribute_name = in.read_string();
+            const auto tag = in.read<Tag>();
+            const auto size = in.read<uint64_t>();
+            const auto data = in.skip(size);
+            attributes.emplace(std::move(attribute_name), std::make_pair(tag, BinaryStream(data, data + size)));
+        }
+
+        const auto rt_info = in.read_strings();
+
+        auto node = createNode(type, version, opset, inputs, attributes);
+        for (const auto& control_dependency : control_dependencies) {
+            node->add_control_dependency(control_dependency);
+        }
+        for (size_t j = 0; j + 1 < rt_info.size(); j += 2) {
+            node->get_rt_info()[rt_info[j]] = std::make_shared<::ngraph::VariantWrapper<std::string>>(rt_info[j + 1]);
+        }
+        node->set_friendly_name(friendly_name);
+        for (size_t j = 0; j < tensor_names.size() && j < node->get_output_size(); ++j) {
+            if (!tensor_names[j].empty())
+                node->get_output_tensor(j).set_names({tensor_names[j].begin(), tensor_names[j].end()});
+        }
+        nodes.emplace_back(std::move(node));
+    }
+
+    auto read_nodes = [&](const char* kind) {
+        std::vector<std::shared_ptr<ngraph::Node>> result(in.read_count<uint32_t>(sizeof(uint32_t)));
+        for (auto& node : result) {
+            node = get_node(in.read<uint32_t>());
+            if (!node)
+                THROW_IE_EXCEPTION << "Binary IR is corrupted: " << kind << " refers to an invalid node";
+        }
+        return result;
+    };
+
+    ngraph::ParameterVector parameters;
+    for (const auto& node : read_nodes("parameter")) {
+        parameters.push_back(ngraph::as_type_ptr<ngraph::op::Parameter>(node));
+        if (!parameters.back())
+            THROW_IE_EXCEPTION << "Binary IR is corrupted: " << node->get_friendly_name() << " is not a Parameter";
+    }
+    ngraph::ResultVector results;
+    for (const auto& node : read_nodes("result")) {
+        results.push_back(ngraph::as_type_ptr<ngraph::op::Result>(node));
+        if (!results.back())
+            THROW_IE_EXCEPTION << "Binary IR is corrupted: " << node->get_friendly_name() << " is not a Result";
+    }
+    ngraph::SinkVector sinks;
+    for (const auto& node : read_nodes("sink")) {
+        sinks.push_back(std::dynamic_pointer_cast<ngraph::op::Sink>(node));
+        if (!sinks.back())
+            THROW_IE_EXCEPTION << "Binary IR is corrupted: " << node->get_friendly_name() << " is not a Sink";
+    }
+
+    return std::make_shared<ngraph::Function>(results, sinks, parameters, name);
+}
+
+}  // namespace
+
+IRBinaryParser::IRBinaryParser(const std::vector<IExtensionPtr>& exts) {
+    // Load default opsets
+    opsets["opset1"] = ngraph::get_opset1();
+    opsets["opset2"] = ngraph::get_opset2();
+    opsets["opset3"] = ngraph::get_opset3();
+    opsets["opset4"] = ngraph::get_opset4();
+    opsets["opset5"] = ngraph::get_opset5();
+    opsets["opset6"] = ngraph::get_opset6();
+    opsets["opset7"] = ngraph::get_opset7();
+
+    // Load custom opsets
+    for (const auto& ext : exts) {
+        for (const auto& it : ext->getOpSets()) {
+            if (opsets.find(it.first) != opsets.end())
+                THROW_IE_EXCEPTION << "Cannot add opset with name: " << it.first
+                                   << ". Opset with the same name already exists.";
+            opsets[it.first] = it.second;
+        }
+    }
+}
+
+std::shared_ptr<ngraph::Function> IRBinaryParser::parse(const Blob::CPtr& model) {
+    OV_ITT_SCOPED_TASK(itt::domains::IRBinaryReader, "IRBinaryParser::parse");
+
+    const auto data = model->cbuffer().as<const char*>();
+    const auto size = static_cast<uint64_t>(model->byteSize());
+
+    Header header;
+    if (size < sizeof(header))
+        THROW_IE_EXCEPTION << "Binary IR is corrupted: the file is too small";
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, ngraph::pass::SerializeBinary::magic, sizeof(header.magic)) != 0)
+        THROW_IE_EXCEPTION << "The model is not a binary IR";
+    if (header.version != ngraph::pass::SerializeBinary::version)
+        THROW_IE_EXCEPTION << "Binary IR version " << header.version << " is not supported";
+    if (header.tables_offset > size || header.tables_size > size - header.tables_offset ||
+        header.weights_offset > size || header.weights_size > size - header.weights_offset)
+        THROW_IE_EXCEPTION << "Binary IR is corrupted: sections are out of the file";
+
+    BinaryStream tables(data + header.tables_offset, data + header.tables_offset + header.tables_size);
+    FunctionParser parser(model, header, opsets, variables);
+    return parser.parse(tables);
+}
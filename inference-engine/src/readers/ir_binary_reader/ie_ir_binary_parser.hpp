@@ -0,0 +1,36 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/function.hpp>
+#include <ngraph/op/util/variable.hpp>
+#include <ngraph/opsets/opset.hpp>
+
+#include <ie_blob.h>
+#include <ie_iextension.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Builds ngraph::Function from the tables of a binary IR, the model blob must stay
+ * alive while constants refer to it
+ */
+class IRBinaryParser {
+public:
+    explicit IRBinaryParser(const std::vector<IExtensionPtr>& exts);
+
+    std::shared_ptr<ngraph::Function> parse(const Blob::CPtr& model);
+
+private:
+    std::unordered_map<std::string, ngraph::OpSet> opsets;
+    std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>> variables;
+};
+
+}  // namespace InferenceEngine
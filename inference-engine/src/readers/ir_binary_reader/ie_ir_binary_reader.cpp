@@ -0,0 +1,76 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ie_ir_binary_reader.hpp>
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <transformations/serialize_binary.hpp>
+
+#include "ie_ir_binary_parser.hpp"
+#include "ie_ir_binary_itt.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+using Header = ngraph::pass::SerializeBinary::Header;
+
+bool readHeader(std::istream& model, Header& header) {
+    model.seekg(0, model.beg);
+    model.read(reinterpret_cast<char*>(&header), sizeof(header));
+    const bool valid = model.gcount() == sizeof(header) &&
+                       std::memcmp(header.magic, ngraph::pass::SerializeBinary::magic, sizeof(header.magic)) == 0;
+    model.clear();
+    model.seekg(0, model.beg);
+    return valid;
+}
+
+}  // namespace
+
+bool IRBinaryReader::supportModel(std::istream& model) const {
+    OV_ITT_SCOPED_TASK(itt::domains::IRBinaryReader, "IRBinaryReader::supportModel");
+
+    Header header;
+    return readHeader(model, header);
+}
+
+CNNNetwork IRBinaryReader::read(std::istream& model, const std::vector<IExtensionPtr>& exts) const {
+    return read(model, nullptr, exts);
+}
+
+CNNNetwork IRBinaryReader::read(std::istream& model, const Blob::CPtr& weights, const std::vector<IExtensionPtr>& exts) const {
+    OV_ITT_SCOPED_TASK(itt::domains::IRBinaryReader, "IRBinaryReader::read");
+
+    Header header;
+    if (!readHeader(model, header))
+        THROW_IE_EXCEPTION << "The model is not a binary IR";
+
+    // The core passes the mapped model file as weights, the stream is read only if weights are another data
+    Blob::CPtr blob = weights;
+    if (!blob || blob->byteSize() < sizeof(header) ||
+        std::memcmp(blob->cbuffer().as<const char*>(), &header, sizeof(header)) != 0) {
+        model.seekg(0, model.end);
+        const size_t size = model.tellg();
+        model.seekg(0, model.beg);
+
+        auto content = make_shared_blob<uint8_t>({Precision::U8, {size}, Layout::C});
+        content->allocate();
+        model.read(content->buffer(), size);
+        if (static_cast<size_t>(model.gcount()) != size)
+            THROW_IE_EXCEPTION << "Cannot read the binary IR";
+        blob = content;
+    }
+
+    IRBinaryParser parser(exts);
+    return CNNNetwork(parser.parse(blob), exts);
+}
+
+INFERENCE_PLUGIN_API(void) InferenceEngine::CreateReader(std::shared_ptr<IReader>& reader) {
+    reader = std::make_shared<IRBinaryReader>();
+}
@@ -0,0 +1,56 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_api.h>
+#include <ie_blob.h>
+#include <ie_common.h>
+#include <ie_iextension.h>
+
+#include <ie_reader.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+
+/**
+ * @brief This class builds a network from the binary IR produced by ngraph::pass::SerializeBinary
+ */
+class IRBinaryReader: public IReader {
+public:
+    /**
+     * @brief Checks that reader supports format of the model
+     * @param model stream with model
+     * @return true if format is supported
+     */
+    bool supportModel(std::istream& model) const override;
+    /**
+     * @brief Reads the model to CNNNetwork
+     * @param model stream with model
+     * @param exts vector with extensions
+     *
+     * @return CNNNetwork
+     */
+    CNNNetwork read(std::istream& model, const std::vector<IExtensionPtr>& exts) const override;
+    /**
+     * @brief Reads the model to CNNNetwork
+     * @param model stream with model
+     * @param weights blob with the content of the model file; constants share it instead of copying
+     * @param exts vector with extensions
+     *
+     * @return CNNNetwork
+     */
+    CNNNetwork read(std::istream& model, const Blob::CPtr& weights, const std::vector<IExtensionPtr>& exts) const override;
+
+    /**
+     * @brief The model file keeps its weights, so the core maps the model file itself as the weights blob
+     */
+    std::vector<std::string> getDataFileExtensions() const override {
+        return {"irb"};
+    }
+};
+
+}  // namespace InferenceEngine
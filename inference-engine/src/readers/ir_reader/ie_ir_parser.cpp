@@ -6,6 +6,8 @@
 #include "ie_ir_itt.hpp"
 
 #include <algorithm>
+#include <cerrno>
+#include <cstdlib>
 #include <deque>
 #include <map>
 #include <memory>
@@ -563,7 +565,7 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
         V10Parser::GenericLayerParams params;
     };
 
-    std::map<size_t/*layer-id*/, node_params> params;
+    std::unordered_map<size_t/*layer-id*/, node_params> params;
 
     std::vector<size_t/*layer-id*/> outputs;
     std::unordered_set<std::string> opName;
@@ -580,8 +582,8 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
         }
     }
 
-    std::map<size_t/*to-layer-id*/, std::vector<edge>> edges;
-    std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
+    std::unordered_map<size_t/*to-layer-id*/, std::vector<edge>> edges;
+    std::unordered_map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
 
     // Read all edges and store them for further usage
     FOREACH_CHILD(_ec, root.child("edges"), "edge") {
@@ -592,18 +594,28 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
         edges[toLayer].push_back({fromLayer, fromPort, toPort});
     }
 
-    // Run DFS starting from outputs to get nodes topological order
-    std::set<size_t> used;
+    // Run DFS starting from outputs to get nodes topological order.
+    // The explicit stack keeps long chains of layers from overflowing the call stack.
+    std::unordered_set<size_t> used;
     std::vector<size_t> order;
-    std::function<void(size_t)> dfs = [&edges, &order, &used, &dfs](const size_t id) {
-        if (used.count(id)) return;
-        used.insert(id);
-        for (auto& edge : edges[id]) {
-            dfs(edge.fromLayerId);
+    order.reserve(params.size());
+    std::vector<std::pair<size_t/*layer-id*/, size_t/*next edge*/>> stack;
+    for (const auto output : outputs) {
+        if (!used.insert(output).second) continue;
+        stack.emplace_back(output, 0);
+        while (!stack.empty()) {
+            auto& top = stack.back();
+            auto& in_edges = edges[top.first];
+            if (top.second < in_edges.size()) {
+                const auto from = in_edges[top.second++].fromLayerId;
+                if (used.insert(from).second)
+                    stack.emplace_back(from, 0);
+            } else {
+                order.push_back(top.first);
+                stack.pop_back();
+            }
         }
-        order.push_back(id);
-    };
-    std::for_each(outputs.begin(), outputs.end(), dfs);
+    }
 
     OV_ITT_TASK_NEXT(taskChain, "ConstructNgraphNodes");
 
@@ -690,10 +702,12 @@ V10Parser::V10Parser::GenericLayerParams XmlDeserializer::parseGenericParams(
         port.portId = GetIntAttr(parentNode, "id");
 
         FOREACH_CHILD(node, parentNode, "dim") {
-            int64_t dim = 0;
             const pugi::char_t* dimVal = node.child_value();
-            std::stringstream ss(dimVal);
-            if (!(ss >> dim) || dim < 0) {
+            // strtoll avoids constructing a stream for every dimension of every port
+            char* end = nullptr;
+            errno = 0;
+            const int64_t dim = std::strtoll(dimVal, &end, 10);
+            if (end == dimVal || errno == ERANGE || dim < 0) {
                 THROW_IE_EXCEPTION << "dimension (" << dimVal << ") in node " << node.name()
                                    << " must be a non-negative integer: at offset "
                                    << node.offset_debug();
@@ -816,7 +830,10 @@ std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
         }
         ngraphNode->set_arguments(inputs);
         XmlDeserializer visitor(node, weights, opsets, variables);
-        if (ngraphNode->visit_attributes(visitor)) {
+        // Shape inference runs when the node is cloned below, so doing it after visiting is only
+        // needed by sub-graph operations which clone their bodies specialized to the inferred shapes
+        if (ngraphNode->visit_attributes(visitor) &&
+            std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(ngraphNode)) {
             ngraphNode->constructor_validate_and_infer_types();
         }
 
@@ -0,0 +1,100 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "ngraph/opsets/opset.hpp"
+#include "ngraph/pass/pass.hpp"
+#include "transformations_visibility.hpp"
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API SerializeBinary;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief SerializeBinary transformation converts ngraph::Function into a single binary IR file
+ *
+ * The file starts with a Header followed by flat tables describing the function and the weights
+ * section. Every function (including bodies of sub-graph operations) is stored as:
+ * - name;
+ * - nodes in topological order: type name, type version, opset, friendly name,
+ *   inputs as (node index, output index) pairs, control dependencies, tensor names of outputs,
+ *   attributes collected by AttributeVisitor and supported runtime info;
+ * - indices of parameters, results and sinks.
+ * Attributes are stored as (name, Tag, value) records, buffers (e.g. values of constants) are
+ * stored as (offset, size) pairs referring to the weights section. Buffers are aligned to
+ * Header::alignment from the beginning of the file, so a mapped file can be shared by constants
+ * without copying.
+ * @attention
+ * - execution graphs are not supported
+ * - the file has host byte order
+ */
+class ngraph::pass::SerializeBinary : public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+    explicit SerializeBinary(std::ostream& stream, std::map<std::string, ngraph::OpSet> custom_opsets = {});
+    explicit SerializeBinary(const std::string& path, std::map<std::string, ngraph::OpSet> custom_opsets = {});
+
+    static constexpr char magic[8] = {'O', 'V', 'B', 'I', 'N', 'I', 'R', '\0'};
+    static constexpr uint32_t version = 1;
+    static constexpr uint64_t alignment = 64;
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t reserved;
+        uint64_t tables_offset;
+        uint64_t tables_size;
+        uint64_t weights_offset;
+        uint64_t weights_size;
+    };
+
+    enum class Tag : uint8_t {
+        BOOL,
+        STRING,
+        INT64,
+        DOUBLE,
+        VEC_INT8,
+        VEC_INT16,
+        VEC_INT32,
+        VEC_INT64,
+        VEC_UINT8,
+        VEC_UINT16,
+        VEC_UINT32,
+        VEC_UINT64,
+        VEC_FLOAT,
+        VEC_DOUBLE,
+        VEC_STRING,
+        FUNCTION,
+        BUFFER,
+        VARIABLE,
+        INPUT_DESCRIPTIONS,
+        OUTPUT_DESCRIPTIONS,
+        SPECIAL_BODY_PORTS,
+    };
+
+    enum class Description : uint8_t {
+        SLICE_INPUT,
+        MERGED_INPUT,
+        INVARIANT_INPUT,
+        BODY_OUTPUT,
+        CONCAT_OUTPUT,
+    };
+
+private:
+    std::ostream* m_stream;
+    const std::string m_path;
+    const std::map<std::string, ngraph::OpSet> m_custom_opsets;
+};
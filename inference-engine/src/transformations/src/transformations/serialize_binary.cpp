@@ -0,0 +1,407 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "itt.hpp"
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <unordered_map>
+#include <utility>
+
+#include <ngraph/variant.hpp>
+#include "ngraph/ops.hpp"
+#include "ngraph/opsets/opset.hpp"
+#include "transformations/serialize_binary.hpp"
+
+using namespace ngraph;
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::SerializeBinary, "SerializeBinary", 0);
+
+constexpr char pass::SerializeBinary::magic[8];
+constexpr uint32_t pass::SerializeBinary::version;
+constexpr uint64_t pass::SerializeBinary::alignment;
+
+namespace {  // helpers
+using Tag = pass::SerializeBinary::Tag;
+using Description = pass::SerializeBinary::Description;
+
+// Runtime info which is preserved by the IR
+const std::vector<std::string> rt_info_names {
+    "PrimitivesPriority",
+    "alt_width",
+};
+
+class Buffer {
+public:
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "Only plain values can be written");
+        write_raw(&value, sizeof(T));
+    }
+
+    void write(const std::string& value) {
+        write(static_cast<uint32_t>(value.size()));
+        write_raw(value.data(), value.size());
+    }
+
+    template <typename T>
+    void write(const std::vector<T>& values) {
+        write(static_cast<uint64_t>(values.size()));
+        write_raw(values.data(), values.size() * sizeof(T));
+    }
+
+    void write(const std::vector<std::string>& values) {
+        write(static_cast<uint64_t>(values.size()));
+        for (const auto& value : values) {
+            write(value);
+        }
+    }
+
+    void write_raw(const void* data, size_t size) {
+        auto bytes = static_cast<const char*>(data);
+        m_data.insert(m_data.end(), bytes, bytes + size);
+    }
+
+    template <typename T>
+    void patch(size_t position, const T& value) {
+        std::memcpy(m_data.data() + position, &value, sizeof(T));
+    }
+
+    void append(const Buffer& other) {
+        m_data.insert(m_data.end(), other.m_data.begin(), other.m_data.end());
+    }
+
+    size_t size() const {
+        return m_data.size();
+    }
+
+    const std::vector<char>& data() const {
+        return m_data;
+    }
+
+private:
+    std::vector<char> m_data;
+};
+
+uint64_t align(uint64_t offset) {
+    return (offset + pass::SerializeBinary::alignment - 1) / pass::SerializeBinary::alignment *
+           pass::SerializeBinary::alignment;
+}
+
+// Buffers are only collected while the tables are written and are copied to the file at the end,
+// buffers shared by several constants are stored once. Constants may refer to different parts
+// of the same memory, so a buffer is identified by its size as well as by its address
+class Weights {
+public:
+    uint64_t add(const std::shared_ptr<runtime::AlignedBuffer>& buffer) {
+        const auto key = std::make_pair(static_cast<const void*>(buffer->get_ptr()), buffer->size());
+        auto found = m_offsets.find(key);
+        if (found != m_offsets.end()) {
+            return found->second;
+        }
+        const auto offset = align(m_size);
+        m_buffers.emplace_back(offset, buffer);
+        m_offsets.emplace(key, offset);
+        m_size = offset + buffer->size();
+        return offset;
+    }
+
+    void save(std::ostream& stream) const {
+        uint64_t written = 0;
+        const std::vector<char> padding(pass::SerializeBinary::alignment, 0);
+        for (const auto& item : m_buffers) {
+            stream.write(padding.data(), item.first - written);
+            stream.write(item.second->get_ptr<char>(), item.second->size());
+            written = item.first + item.second->size();
+        }
+    }
+
+    uint64_t size() const {
+        return m_size;
+    }
+
+private:
+    std::vector<std::pair<uint64_t, std::shared_ptr<runtime::AlignedBuffer>>> m_buffers;
+    std::map<std::pair<const void*, size_t>, uint64_t> m_offsets;
+    uint64_t m_size = 0;
+};
+
+void write_function(Buffer& out, Weights& weights, const Function& f,
+                    const std::map<std::string, OpSet>& custom_opsets);
+
+class BinarySerializer : public AttributeVisitor {
+    Buffer& m_out;
+    Weights& m_weights;
+    const std::map<std::string, OpSet>& m_custom_opsets;
+    uint32_t m_count = 0;
+
+    // every record stores the size of its value, so a reader can skip records it doesn't need
+    size_t begin_attribute(const std::string& name, Tag tag) {
+        m_out.write(name);
+        m_out.write(tag);
+        const auto position = m_out.size();
+        m_out.write(uint64_t{0});
+        return position;
+    }
+
+    void end_attribute(size_t position) {
+        m_out.patch(position, static_cast<uint64_t>(m_out.size() - position - sizeof(uint64_t)));
+        m_count++;
+    }
+
+    template <typename T>
+    void write_attribute(const std::string& name, Tag tag, const T& value) {
+        const auto position = begin_attribute(name, tag);
+        m_out.write(value);
+        end_attribute(position);
+    }
+
+public:
+    BinarySerializer(Buffer& out, Weights& weights, const std::map<std::string, OpSet>& custom_opsets)
+        : m_out(out), m_weights(weights), m_custom_opsets(custom_opsets) {}
+
+    uint32_t count() const {
+        return m_count;
+    }
+
+    void on_adapter(const std::string& name, ValueAccessor<void>& adapter) override {
+        using InputDescriptions = std::vector<std::shared_ptr<op::util::SubGraphOp::InputDescription>>;
+        using OutputDescriptions = std::vector<std::shared_ptr<op::util::SubGraphOp::OutputDescription>>;
+        if (const auto& a = as_type<AttributeAdapter<std::shared_ptr<runtime::AlignedBuffer>>>(&adapter)) {
+            write_attribute(name, Tag::BUFFER,
+                            std::array<uint64_t, 2>{m_weights.add(a->get()), a->get()->size()});
+        } else if (const auto& a = as_type<AttributeAdapter<std::shared_ptr<Variable>>>(&adapter)) {
+            write_attribute(name, Tag::VARIABLE, a->get()->get_info().variable_id);
+        } else if (const auto& a = as_type<AttributeAdapter<InputDescriptions>>(&adapter)) {
+            const auto position = begin_attribute(name, Tag::INPUT_DESCRIPTIONS);
+            m_out.write(static_cast<uint64_t>(a->get().size()));
+            for (const auto& description : a->get()) {
+                if (auto slice = as_type_ptr<op::util::SubGraphOp::SliceInputDescription>(description)) {
+                    m_out.write(Description::SLICE_INPUT);
+                    m_out.write(std::array<int64_t, 5>{slice->m_start, slice->m_stride, slice->m_part_size,
+                                                       slice->m_end, slice->m_axis});
+                } else if (auto merged = as_type_ptr<op::util::SubGraphOp::MergedInputDescription>(description)) {
+                    m_out.write(Description::MERGED_INPUT);
+                    m_out.write(merged->m_body_value_index);
+                } else {
+                    NGRAPH_CHECK(as_type_ptr<op::util::SubGraphOp::InvariantInputDescription>(description),
+                                 "Unsupported input description of ", name);
+                    m_out.write(Description::INVARIANT_INPUT);
+                }
+                m_out.write(description->m_input_index);
+                m_out.write(description->m_body_parameter_index);
+            }
+            end_attribute(position);
+        } else if (const auto& a = as_type<AttributeAdapter<OutputDescriptions>>(&adapter)) {
+            const auto position = begin_attribute(name, Tag::OUTPUT_DESCRIPTIONS);
+            m_out.write(static_cast<uint64_t>(a->get().size()));
+            for (const auto& description : a->get()) {
+                if (auto concat = as_type_ptr<op::util::SubGraphOp::ConcatOutputDescription>(description)) {
+                    m_out.write(Description::CONCAT_OUTPUT);
+                    m_out.write(std::array<int64_t, 5>{concat->m_start, concat->m_stride, concat->m_part_size,
+                                                       concat->m_end, concat->m_axis});
+                } else {
+                    auto body = as_type_ptr<op::util::SubGraphOp::BodyOutputDescription>(description);
+                    NGRAPH_CHECK(body, "Unsupported output description of ", name);
+                    m_out.write(Description::BODY_OUTPUT);
+                    m_out.write(body->m_iteration);
+                }
+                m_out.write(description->m_body_value_index);
+                m_out.write(description->m_output_index);
+            }
+            end_attribute(position);
+        } else if (const auto& a = as_type<AttributeAdapter<op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            write_attribute(name, Tag::SPECIAL_BODY_PORTS,
+                            std::array<int64_t, 2>{a->get().current_iteration_input_idx,
+                                                   a->get().body_condition_output_idx});
+        }
+    }
+
+    void on_adapter(const std::string& name, ValueAccessor<bool>& adapter) override {
+        write_attribute(name, Tag::BOOL, static_cast<uint8_t>(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::string>& adapter) override {
+        write_attribute(name, Tag::STRING, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<int64_t>& adapter) override {
+        write_attribute(name, Tag::INT64, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<double>& adapter) override {
+        write_attribute(name, Tag::DOUBLE, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<int8_t>>& adapter) override {
+        write_attribute(name, Tag::VEC_INT8, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<int16_t>>& adapter) override {
+        write_attribute(name, Tag::VEC_INT16, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<int32_t>>& adapter) override {
+        write_attribute(name, Tag::VEC_INT32, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<int64_t>>& adapter) override {
+        write_attribute(name, Tag::VEC_INT64, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        write_attribute(name, Tag::VEC_UINT8, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        write_attribute(name, Tag::VEC_UINT16, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        write_attribute(name, Tag::VEC_UINT32, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        write_attribute(name, Tag::VEC_UINT64, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<float>>& adapter) override {
+        write_attribute(name, Tag::VEC_FLOAT, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<double>>& adapter) override {
+        write_attribute(name, Tag::VEC_DOUBLE, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<std::string>>& adapter) override {
+        write_attribute(name, Tag::VEC_STRING, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::shared_ptr<Function>>& adapter) override {
+        const auto position = begin_attribute(name, Tag::FUNCTION);
+        write_function(m_out, m_weights, *adapter.get(), m_custom_opsets);
+        end_attribute(position);
+    }
+};
+
+std::string get_opset_name(const Node* n, const std::map<std::string, OpSet>& custom_opsets) {
+    // the same assignment as in the XML IR, so both formats are read with the same opsets
+    if (n->get_type_info() == Node::type_info_t("ShuffleChannels", 0)) {
+        return "opset3";
+    }
+    auto opsets = std::array<std::reference_wrapper<const OpSet>, 7>{
+        get_opset1(), get_opset2(), get_opset3(), get_opset4(), get_opset5(), get_opset6(), get_opset7()};
+    for (size_t idx = 0; idx < opsets.size(); idx++) {
+        if (opsets[idx].get().contains_op_type(n)) {
+            return "opset" + std::to_string(idx + 1);
+        }
+    }
+    for (const auto& custom_opset : custom_opsets) {
+        if (custom_opset.second.contains_op_type(n)) {
+            return custom_opset.first;
+        }
+    }
+    return "experimental";
+}
+
+template <typename Nodes>
+void write_indices(Buffer& out, const Nodes& nodes, const std::unordered_map<const Node*, uint32_t>& ids) {
+    out.write(static_cast<uint32_t>(nodes.size()));
+    for (const auto& node : nodes) {
+        out.write(ids.at(node.get()));
+    }
+}
+
+void write_function(Buffer& out, Weights& weights, const Function& f,
+                    const std::map<std::string, OpSet>& custom_opsets) {
+    const auto ops = f.get_ordered_ops();
+    std::unordered_map<const Node*, uint32_t> ids;
+    for (const auto& node : ops) {
+        ids.emplace(node.get(), static_cast<uint32_t>(ids.size()));
+    }
+
+    out.write(f.get_friendly_name());
+    out.write(static_cast<uint32_t>(ops.size()));
+    for (const auto& node : ops) {
+        NGRAPH_CHECK(node->get_rt_info().count("execTimeMcs") == 0,
+                     "Execution graphs can't be serialized to binary IR");
+        out.write(std::string(node->get_type_info().name));
+        out.write(node->get_type_info().version);
+        out.write(get_opset_name(node.get(), custom_opsets));
+        out.write(node->get_friendly_name());
+
+        out.write(static_cast<uint32_t>(node->get_input_size()));
+        for (const auto& input : node->inputs()) {
+            const auto source = input.get_source_output();
+            out.write(ids.at(source.get_node()));
+            out.write(static_cast<uint32_t>(source.get_index()));
+        }
+        write_indices(out, node->get_control_dependencies(), ids);
+
+        out.write(static_cast<uint32_t>(node->get_output_size()));
+        for (const auto& output : node->outputs()) {
+            const auto& names = output.get_tensor().get_names();
+            out.write(std::vector<std::string>(names.begin(), names.end()));
+        }
+
+        Buffer attributes;
+        BinarySerializer visitor(attributes, weights, custom_opsets);
+        NGRAPH_CHECK(node->visit_attributes(visitor), "Visitor API is not supported in ", node);
+        out.write(visitor.count());
+        out.append(attributes);
+
+        std::vector<std::string> rt_info;
+        for (const auto& rt_info_name : rt_info_names) {
+            const auto found = node->get_rt_info().find(rt_info_name);
+            if (found == node->get_rt_info().end())
+                continue;
+            if (auto value = std::dynamic_pointer_cast<VariantImpl<std::string>>(found->second)) {
+                rt_info.push_back(rt_info_name);
+                rt_info.push_back(value->get());
+            }
+        }
+        out.write(rt_info);
+    }
+    write_indices(out, f.get_parameters(), ids);
+    write_indices(out, f.get_results(), ids);
+    write_indices(out, f.get_sinks(), ids);
+}
+}  // namespace
+
+bool pass::SerializeBinary::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    RUN_ON_FUNCTION_SCOPE(SerializeBinary);
+
+    Buffer tables;
+    Weights weights;
+    write_function(tables, weights, *f, m_custom_opsets);
+
+    Header header{};
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version = version;
+    header.tables_offset = sizeof(Header);
+    header.tables_size = tables.data().size();
+    header.weights_offset = align(header.tables_offset + header.tables_size);
+    header.weights_size = weights.size();
+
+    auto save = [&](std::ostream& stream) {
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        stream.write(tables.data().data(), tables.data().size());
+        const std::vector<char> padding(header.weights_offset - header.tables_offset - header.tables_size, 0);
+        stream.write(padding.data(), padding.size());
+        weights.save(stream);
+        stream.flush();
+        NGRAPH_CHECK(stream.good(), "Failed to write binary IR");
+    };
+
+    if (m_stream) {
+        save(*m_stream);
+    } else {
+        std::ofstream stream(m_path, std::ios::out | std::ios::binary);
+        NGRAPH_CHECK(stream, "Can't open binary IR file: \"" + m_path + "\"");
+        save(stream);
+    }
+
+    // Return false because we didn't change nGraph Function
+    return false;
+}
+
+pass::SerializeBinary::SerializeBinary(std::ostream& stream, std::map<std::string, OpSet> custom_opsets)
+    : m_stream{&stream}
+    , m_path{}
+    , m_custom_opsets{custom_opsets}
+{
+}
+
+pass::SerializeBinary::SerializeBinary(const std::string& path, std::map<std::string, OpSet> custom_opsets)
+    : m_stream{nullptr}
+    , m_path{path}
+    , m_custom_opsets{custom_opsets}
+{
+}
@@ -0,0 +1,115 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "gtest/gtest.h"
+#include "ie_core.hpp"
+#include "ngraph/opsets/opset1.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "transformations/serialize_binary.hpp"
+
+#ifndef IR_SERIALIZATION_MODELS_PATH  // should be already defined by cmake
+#define IR_SERIALIZATION_MODELS_PATH ""
+#endif
+
+typedef std::tuple<std::string, std::string> SerializationParams;
+
+class BinarySerializationTest: public CommonTestUtils::TestsCommon,
+                               public testing::WithParamInterface<SerializationParams> {
+public:
+    std::string m_model_path;
+    std::string m_binary_path;
+    std::string m_out_path;
+
+    void SetUp() override {
+        m_model_path = IR_SERIALIZATION_MODELS_PATH + std::get<0>(GetParam());
+        if (!std::get<1>(GetParam()).empty()) {
+            m_binary_path = IR_SERIALIZATION_MODELS_PATH + std::get<1>(GetParam());
+        }
+
+        m_out_path = GetTestName() + "_" + GetTimestamp() + ".irb";
+    }
+
+    void TearDown() override {
+        std::remove(m_out_path.c_str());
+    }
+};
+
+TEST_P(BinarySerializationTest, CompareFunctions) {
+    InferenceEngine::Core ie;
+    auto expected = ie.ReadNetwork(m_model_path, m_binary_path);
+
+    ngraph::pass::SerializeBinary(m_out_path).run_on_function(expected.getFunction());
+    auto result = ie.ReadNetwork(m_out_path);
+
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(result.getFunction(), expected.getFunction(), true, false, true, true, true);
+    ASSERT_TRUE(success) << message;
+}
+
+TEST_P(BinarySerializationTest, CompareFunctionsFromMemory) {
+    InferenceEngine::Core ie;
+    auto expected = ie.ReadNetwork(m_model_path, m_binary_path);
+
+    std::stringstream stream;
+    ngraph::pass::SerializeBinary(stream).run_on_function(expected.getFunction());
+    auto result = ie.ReadNetwork(stream.str(), InferenceEngine::Blob::CPtr());
+
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(result.getFunction(), expected.getFunction(), true, false, true, true, true);
+    ASSERT_TRUE(success) << message;
+}
+
+INSTANTIATE_TEST_CASE_P(IRBinarySerialization, BinarySerializationTest,
+        testing::Values(std::make_tuple("add_abc.xml", "add_abc.bin"),
+                        std::make_tuple("add_abc_f64.xml", ""),
+                        std::make_tuple("split_equal_parts_2d.xml", "split_equal_parts_2d.bin"),
+                        std::make_tuple("addmul_abc.xml", "addmul_abc.bin"),
+                        std::make_tuple("add_abc_initializers.xml", "add_abc_initializers.bin"),
+                        std::make_tuple("add_abc_initializers_u1_const.xml", "add_abc_initializers_u1_const.bin"),
+                        std::make_tuple("experimental_detectron_detection_output_opset6.xml", ""),
+                        std::make_tuple("nms5.xml", "nms5.bin"),
+                        std::make_tuple("shape_of.xml", ""),
+                        std::make_tuple("pad_with_shape_of.xml", ""),
+                        std::make_tuple("conv_with_rt_info.xml", ""),
+                        std::make_tuple("loop_2d_add.xml", "loop_2d_add.bin"),
+                        std::make_tuple("nms5_dynamism.xml", "nms5_dynamism.bin")));
+
+// Constants referring to the beginning of the same memory with different sizes must not be stored once
+TEST(BinarySerializationSharedMemoryTest, ConstantsWithSameAddressAndOtherSizes) {
+    auto data = std::make_shared<std::vector<float>>(std::vector<float>{1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f});
+    using Buffer = ngraph::runtime::SharedBuffer<std::shared_ptr<std::vector<float>>>;
+    auto makeConstant = [&](size_t size) {
+        auto buffer = std::make_shared<Buffer>(reinterpret_cast<char*>(data->data()), size * sizeof(float), data);
+        return std::make_shared<ngraph::opset1::Constant>(ngraph::element::f32, ngraph::Shape{size}, buffer);
+    };
+
+    // both orders of the results, so the smaller constant is stored first in one of the functions
+    for (bool smallFirst : {true, false}) {
+        auto smallParam = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{4});
+        auto bigParam = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{8});
+        auto smallResult = std::make_shared<ngraph::opset1::Result>(std::make_shared<ngraph::opset1::Add>(smallParam, makeConstant(4)));
+        auto bigResult = std::make_shared<ngraph::opset1::Result>(std::make_shared<ngraph::opset1::Add>(bigParam, makeConstant(8)));
+        auto expected = std::make_shared<ngraph::Function>(
+            smallFirst ? ngraph::ResultVector{smallResult, bigResult} : ngraph::ResultVector{bigResult, smallResult},
+            ngraph::ParameterVector{smallParam, bigParam});
+
+        std::stringstream stream;
+        ngraph::pass::SerializeBinary(stream).run_on_function(expected);
+        InferenceEngine::Core ie;
+        auto result = ie.ReadNetwork(stream.str(), InferenceEngine::Blob::CPtr());
+
+        bool success;
+        std::string message;
+        std::tie(success, message) = compare_functions(result.getFunction(), expected, true);
+        ASSERT_TRUE(success) << message;
+    }
+}
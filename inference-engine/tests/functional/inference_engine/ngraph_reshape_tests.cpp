@@ -21,7 +21,9 @@
 #include <ngraph/op/relu.hpp>
 #include <ngraph/op/result.hpp>
 #include <ngraph/opsets/opset.hpp>
+#include <ngraph/opsets/opset1.hpp>
 #include <ngraph/graph_util.hpp>
+#include <ngraph/runtime/host_tensor.hpp>
 
 #include <legacy/ie_util_internal.hpp>
 #include <ie_core.hpp>
@@ -210,6 +212,123 @@ TEST_F(NGraphReshapeTests, CNNReshapeSpatialReLUWithoutCloneFunction) {
     ASSERT_EQ(ngraph->get_results()[0]->get_shape(), ngraph::Shape({1, 3, 25, 25}));
 }
 
+TEST_F(NGraphReshapeTests, CNNReshapeSwitchBetweenShapes) {
+    std::shared_ptr<ngraph::Function> ngraph;
+    {
+        auto data = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 22, 22});
+        data->set_friendly_name("data");
+        auto other = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 8});
+        other->set_friendly_name("other");
+        auto relu = std::make_shared<ngraph::opset1::Relu>(data);
+        // the target shape is computed from the input shape, so the value is changed on reshape as well
+        auto shape_of = std::make_shared<ngraph::opset1::ShapeOf>(data);
+        auto reshape = std::make_shared<ngraph::opset1::Reshape>(relu, shape_of, false);
+        auto other_relu = std::make_shared<ngraph::opset1::Relu>(other);
+
+        ngraph = std::make_shared<ngraph::Function>(ngraph::NodeVector{reshape, other_relu},
+                                                    ngraph::ParameterVector{data, other});
+    }
+
+    CNNNetwork cnnNetwork(ngraph);
+    const auto data = ngraph->get_parameters()[0];
+    for (const auto& dims : std::vector<std::vector<size_t>>{{1, 3, 25, 25}, {2, 3, 22, 22}, {1, 3, 25, 25}, {1, 3, 22, 22}}) {
+        ASSERT_NO_THROW(cnnNetwork.reshape({{"data", dims}}));
+
+        ASSERT_EQ(ngraph->get_parameters()[0], data);
+        ASSERT_EQ(ngraph->get_results()[0]->get_shape(), ngraph::Shape(dims));
+        ASSERT_EQ(ngraph->get_results()[1]->get_shape(), ngraph::Shape({1, 8}));
+        ASSERT_EQ(cnnNetwork.getInputsInfo()["data"]->getTensorDesc().getDims(), dims);
+    }
+}
+
+TEST_F(NGraphReshapeTests, CNNReshapeAfterFunctionIsEdited) {
+    std::shared_ptr<ngraph::Function> ngraph;
+    {
+        auto data = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 22, 22});
+        data->set_friendly_name("data");
+        auto relu = std::make_shared<ngraph::opset1::Relu>(data);
+        ngraph = std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{data});
+    }
+
+    CNNNetwork cnnNetwork(ngraph);
+    ASSERT_NO_THROW(cnnNetwork.reshape({{"data", {1, 3, 25, 25}}}));
+    ASSERT_NO_THROW(cnnNetwork.reshape({{"data", {1, 3, 22, 22}}}));
+
+    // shapes memoized for the original operations must not be restored to the edited function
+    auto function = cnnNetwork.getFunction();
+    auto result = function->get_results()[0];
+    auto concat = std::make_shared<ngraph::opset1::Concat>(ngraph::OutputVector{result->input_value(0), result->input_value(0)}, 1);
+    result->input(0).replace_source_output(concat);
+
+    ASSERT_NO_THROW(cnnNetwork.reshape({{"data", {1, 3, 25, 25}}}));
+    ASSERT_EQ(function->get_results()[0]->get_shape(), ngraph::Shape({1, 6, 25, 25}));
+    ASSERT_NO_THROW(cnnNetwork.reshape({{"data", {1, 3, 22, 22}}}));
+    ASSERT_EQ(function->get_results()[0]->get_shape(), ngraph::Shape({1, 6, 22, 22}));
+}
+
+TEST_F(NGraphReshapeTests, CNNReshapeBackToAutoPaddedShapes) {
+    auto makeFunction = [](const ngraph::Shape& shape) {
+        auto data = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+        data->set_friendly_name("data");
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{4, 3, 3, 3}, std::vector<float>(4 * 3 * 3 * 3, 1.f));
+        auto conv = std::make_shared<ngraph::opset1::Convolution>(data, weights, ngraph::Strides{2, 2}, ngraph::CoordinateDiff{0, 0},
+                                                                  ngraph::CoordinateDiff{0, 0}, ngraph::Strides{1, 1}, ngraph::op::PadType::SAME_UPPER);
+        auto pool = std::make_shared<ngraph::opset1::MaxPool>(data, ngraph::Strides{2, 2}, ngraph::Shape{0, 0}, ngraph::Shape{0, 0},
+                                                              ngraph::Shape{3, 3}, ngraph::op::RoundingType::FLOOR, ngraph::op::PadType::SAME_UPPER);
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{conv, pool}, ngraph::ParameterVector{data});
+    };
+    auto poolOutput = [](const std::shared_ptr<ngraph::opset1::MaxPool>& pool) {
+        const auto inputShape = pool->get_input_shape(0);
+        std::vector<float> inputData(ngraph::shape_size(inputShape));
+        for (size_t i = 0; i < inputData.size(); i++) {
+            inputData[i] = static_cast<float>(i % 17) - 8.f;
+        }
+        auto input = std::make_shared<ngraph::HostTensor>(ngraph::element::f32, inputShape, inputData.data());
+        auto output = std::make_shared<ngraph::HostTensor>(ngraph::element::f32, pool->get_output_shape(0));
+        EXPECT_TRUE(pool->evaluate({output}, {input}));
+        const auto outputData = output->get_data_ptr<const float>();
+        return std::vector<float>(outputData, outputData + ngraph::shape_size(output->get_shape()));
+    };
+
+    const ngraph::Shape shapeA{1, 3, 22, 22}, shapeB{1, 3, 25, 25};
+    auto function = makeFunction(shapeA);
+    CNNNetwork cnnNetwork(function);
+    // SAME_UPPER pads of both operations differ for these shapes, so they are computed again on the way back
+    ASSERT_NO_THROW(cnnNetwork.reshape({{"data", shapeB}}));
+    ASSERT_NO_THROW(cnnNetwork.reshape({{"data", shapeA}}));
+
+    const auto reference = makeFunction(shapeA);
+    const auto conv = ngraph::as_type_ptr<ngraph::opset1::Convolution>(function->get_results()[0]->get_input_node_shared_ptr(0));
+    const auto refConv = ngraph::as_type_ptr<ngraph::opset1::Convolution>(reference->get_results()[0]->get_input_node_shared_ptr(0));
+    ASSERT_EQ(conv->get_output_shape(0), refConv->get_output_shape(0));
+    ASSERT_EQ(conv->get_pads_begin(), refConv->get_pads_begin());
+    ASSERT_EQ(conv->get_pads_end(), refConv->get_pads_end());
+
+    const auto pool = ngraph::as_type_ptr<ngraph::opset1::MaxPool>(function->get_results()[1]->get_input_node_shared_ptr(0));
+    const auto refPool = ngraph::as_type_ptr<ngraph::opset1::MaxPool>(reference->get_results()[1]->get_input_node_shared_ptr(0));
+    ASSERT_EQ(pool->get_output_shape(0), refPool->get_output_shape(0));
+    ASSERT_EQ(poolOutput(pool), poolOutput(refPool));
+}
+
+TEST_F(NGraphReshapeTests, CNNReshapeWithUnregisteredParameter) {
+    std::shared_ptr<ngraph::Function> ngraph;
+    {
+        auto data = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 22, 22});
+        data->set_friendly_name("data");
+        auto relu = std::make_shared<ngraph::opset1::Relu>(data);
+        ngraph = std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{data});
+    }
+
+    CNNNetwork cnnNetwork(ngraph);
+    auto function = cnnNetwork.getFunction();
+    auto relu = function->get_results()[0]->get_input_node_shared_ptr(0);
+    auto other = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 22, 22});
+    auto add = std::make_shared<ngraph::opset1::Add>(relu, other);
+    function->get_results()[0]->input(0).replace_source_output(add);
+
+    ASSERT_THROW(cnnNetwork.reshape({{"data", {1, 3, 25, 25}}}), InferenceEngine::details::InferenceEngineException);
+}
+
 class CustomTestOp: public ngraph::op::Op {
 public:
     static constexpr ngraph::NodeTypeInfo type_info{"CustomTestLayer", 0};
@@ -9,6 +9,7 @@
 #include <ie_parallel.hpp>
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <threading/ie_immediate_executor.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <ie_system_conf.h>
 
 using namespace ::testing;
@@ -211,3 +212,25 @@ static auto AsyncExecutors = ::testing::Values(
 
 INSTANTIATE_TEST_CASE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
 
+
+TEST(CPUStreamsExecutorTests, countersAccountAllTasks) {
+    static constexpr const std::size_t NUMBER_OF_TASKS = 100;
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 2, 1, IStreamsExecutor::ThreadBindingType::NONE};
+    config.SetConfig(CONFIG_KEY_INTERNAL(CPU_STREAM_SPIN_COUNT), "10");
+    ASSERT_EQ(10, config.GetConfig(CONFIG_KEY_INTERNAL(CPU_STREAM_SPIN_COUNT)).as<int>());
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(config);
+
+    std::vector<Future> futures;
+    for (std::size_t i = 0; i < NUMBER_OF_TASKS; i++) {
+        futures.emplace_back(async(taskExecutor, [] {}));
+    }
+    for (auto& f : futures) {
+        f.wait();
+    }
+
+    auto counters = taskExecutor->GetCounters();
+    ASSERT_EQ(NUMBER_OF_TASKS, counters.enqueued);
+    ASSERT_EQ(0u, counters.queued);
+    ASSERT_LE(1u, counters.maxQueued);
+    ASSERT_GE(NUMBER_OF_TASKS, counters.stolen);
+}
@@ -24,7 +24,13 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "8"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_MEMORY_SOLVER, InferenceEngine::PluginConfigParams::CPU_MEMORY_SOLVER_GREEDY}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_MEMORY_SOLVER, InferenceEngine::PluginConfigParams::CPU_MEMORY_SOLVER_BEST_FIT}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SNIPPETS, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SHAPE_CACHE_CAPACITY, "4"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_NUMA_PLACEMENT, InferenceEngine::PluginConfigParams::YES}}
     };
 
     const std::vector<std::map<std::string, std::string>> MultiConfigs = {
@@ -39,7 +45,10 @@ namespace {
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
                     {InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
-                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+                     InferenceEngine::MultiDeviceConfigParams::MULTI_EXPECTED_FINISH_TIME}}
     };
 
     INSTANTIATE_TEST_CASE_P(smoke_BehaviorTests, CorrectConfigTests,
@@ -59,7 +68,12 @@ namespace {
     const std::vector<std::map<std::string, std::string>> inconfigs = {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "OFF"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL, "OFF"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_MEMORY_SOLVER, "FIRST_FIT"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SNIPPETS, "ON"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SHAPE_CACHE_CAPACITY, "-1"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_NUMA_PLACEMENT, "ON"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
@@ -68,7 +82,9 @@ namespace {
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
                     {InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
-                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, "OFF"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiconf = {
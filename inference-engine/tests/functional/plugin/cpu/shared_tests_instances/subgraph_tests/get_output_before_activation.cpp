@@ -19,6 +19,10 @@ namespace {
     };
 
     std::map<std::string, std::string> additional_config = {};
+
+    std::map<std::string, std::string> inter_op_parallel_config = {
+        {InferenceEngine::PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL, InferenceEngine::PluginConfigParams::YES}
+    };
 } // namespace
 
 INSTANTIATE_TEST_CASE_P(OutputBeforeActivation, OutputBeforeActivation,
@@ -29,4 +33,13 @@ INSTANTIATE_TEST_CASE_P(OutputBeforeActivation, OutputBeforeActivation,
         ::testing::ValuesIn(midLayerTypes),
         ::testing::Values(additional_config)),
     OutputBeforeActivation::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(OutputBeforeActivation_InterOpParallel, OutputBeforeActivation,
+    ::testing::Combine(
+        ::testing::Values(CommonTestUtils::DEVICE_CPU),
+        ::testing::Values(InferenceEngine::Precision::FP32),
+        ::testing::ValuesIn(input_sizes),
+        ::testing::ValuesIn(midLayerTypes),
+        ::testing::Values(inter_op_parallel_config)),
+    OutputBeforeActivation::getTestCaseName);
 } // namespace SubgraphTestsDefinitions
@@ -0,0 +1,105 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <auto-batch/auto_batch_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <blob_factory.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* The requests of the BATCH device are executed by the CPU as a part of batches.
+
+    Param   Const
+        \   /
+       Multiply
+          |
+        Relu
+          |
+        Result
+*/
+class AutoBatchTest : public ::testing::Test {
+protected:
+    static InferenceEngine::CNNNetwork makeNetwork(size_t batch) {
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{batch, 3, 4, 4});
+        auto scales = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3, 1, 1}, {-1.f, 2.f, 3.f});
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(param, scales);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(multiply);
+        auto function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(relu)},
+                                                           ngraph::ParameterVector{param}, "AutoBatch");
+        return InferenceEngine::CNNNetwork(function);
+    }
+
+    // every request gets its own input to make sure the items of the batch are not mixed up
+    static void runRequests(InferenceEngine::ExecutableNetwork& execNetwork, const std::string& inputName,
+                            const std::string& outputName, size_t numRequests) {
+        std::vector<InferenceEngine::InferRequest> requests;
+        for (size_t r = 0; r < numRequests; r++) {
+            requests.push_back(execNetwork.CreateInferRequest());
+            auto input = requests.back().GetBlob(inputName);
+            auto inputData = input->buffer().as<float*>();
+            for (size_t i = 0; i < input->size(); i++) {
+                inputData[i] = static_cast<float>((i + r) % 7) - 3.f;
+            }
+        }
+        for (auto&& request : requests) {
+            request.StartAsync();
+        }
+        const std::vector<float> scales = {-1.f, 2.f, 3.f};
+        for (size_t r = 0; r < numRequests; r++) {
+            ASSERT_EQ(InferenceEngine::StatusCode::OK, requests[r].Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+            auto input = requests[r].GetBlob(inputName);
+            auto output = requests[r].GetBlob(outputName);
+            ASSERT_EQ(input->getTensorDesc().getDims(), output->getTensorDesc().getDims());
+            const size_t spatial = 4 * 4;
+            auto inputData = input->cbuffer().as<const float*>();
+            auto outputData = output->cbuffer().as<const float*>();
+            for (size_t i = 0; i < output->size(); i++) {
+                ASSERT_FLOAT_EQ(std::max(0.f, inputData[i] * scales[(i / spatial) % 3]), outputData[i])
+                    << "request " << r << " at " << i;
+            }
+        }
+    }
+};
+
+TEST_F(AutoBatchTest, smoke_InferFullBatches) {
+    InferenceEngine::Core ie;
+    auto network = makeNetwork(1);
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto outputName = network.getOutputsInfo().begin()->first;
+    // the timeout is long enough for the batches to be started only when they are full
+    auto execNetwork = ie.LoadNetwork(network, "BATCH:" + std::string(CommonTestUtils::DEVICE_CPU) + "(4)",
+                                      {{AUTO_BATCH_CONFIG_KEY(TIMEOUT), "10000"}});
+
+    runRequests(execNetwork, inputName, outputName, 8);
+    ASSERT_EQ(2u, execNetwork.GetMetric(METRIC_KEY(AUTO_BATCH_COMPLETED_BATCHES)).as<uint64_t>());
+    ASSERT_FLOAT_EQ(4.f, execNetwork.GetMetric(METRIC_KEY(AUTO_BATCH_AVERAGE_BATCH_SIZE)).as<float>());
+}
+
+TEST_F(AutoBatchTest, smoke_InferPartialBatchOnTimeout) {
+    InferenceEngine::Core ie;
+    auto network = makeNetwork(1);
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto outputName = network.getOutputsInfo().begin()->first;
+    auto execNetwork = ie.LoadNetwork(network, "BATCH:" + std::string(CommonTestUtils::DEVICE_CPU) + "(4)",
+                                      {{AUTO_BATCH_CONFIG_KEY(TIMEOUT), "1"}});
+
+    runRequests(execNetwork, inputName, outputName, 3);
+    ASSERT_LE(execNetwork.GetMetric(METRIC_KEY(AUTO_BATCH_AVERAGE_BATCH_SIZE)).as<float>(), 3.f);
+}
+
+TEST_F(AutoBatchTest, smoke_NetworksWithBatchAreRejected) {
+    InferenceEngine::Core ie;
+    ASSERT_THROW(ie.LoadNetwork(makeNetwork(2), "BATCH:" + std::string(CommonTestUtils::DEVICE_CPU)),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,98 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+#include <cstdint>
+#include <map>
+#include <sstream>
+#include <string>
+
+namespace CPUSubgraphTestsDefinitions {
+
+class CompiledNetworkCacheTest : public ::testing::Test {
+protected:
+    std::string cacheDir = "CompiledNetworkCacheTest_cache";
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+};
+
+// the config set via Core::SetConfig is a part of the cache key, so the cached network is not loaded with stale settings
+TEST_F(CompiledNetworkCacheTest, smoke_CacheKeyDependsOnGlobalConfig) {
+    InferenceEngine::Core ie;
+    InferenceEngine::CNNNetwork network(ngraph::builder::subgraph::makeConvPoolRelu());
+    const std::map<std::string, std::string> config = {{CONFIG_KEY(CACHE_DIR), cacheDir}};
+
+    ie.SetConfig({{CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "1"}}, CommonTestUtils::DEVICE_CPU);
+    auto execNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+    ASSERT_EQ("1", execNetwork.GetConfig(CONFIG_KEY(CPU_THROUGHPUT_STREAMS)).as<std::string>());
+
+    ie.SetConfig({{CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "2"}}, CommonTestUtils::DEVICE_CPU);
+    execNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+    ASSERT_EQ("2", execNetwork.GetConfig(CONFIG_KEY(CPU_THROUGHPUT_STREAMS)).as<std::string>());
+
+    // the same settings hit the cache
+    execNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+    ASSERT_EQ("2", execNetwork.GetConfig(CONFIG_KEY(CPU_THROUGHPUT_STREAMS)).as<std::string>());
+    ASSERT_EQ(2, CommonTestUtils::removeFilesWithExt(cacheDir, "blob"));
+}
+
+// A cache hit imports the network the transformations produced, so they don't run again
+TEST_F(CompiledNetworkCacheTest, smoke_CacheHitSkipsTransformations) {
+    InferenceEngine::Core ie;
+    InferenceEngine::CNNNetwork network(ngraph::builder::subgraph::makeConvPoolRelu());
+    auto execNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+
+    // the exported network is the transformed legacy one instead of the nGraph function
+    std::stringstream exported;
+    execNetwork.Export(exported);
+    std::string pluginName, header;
+    std::getline(exported, pluginName);
+    std::getline(exported, header);
+    ASSERT_NE(std::string::npos, header.find("graph=\"legacy\""));
+    std::uint64_t modelSize = 0;
+    exported.read(reinterpret_cast<char*>(&modelSize), sizeof(modelSize));
+    std::string model(modelSize, '\0');
+    exported.read(&model[0], modelSize);
+    ASSERT_NE(std::string::npos, model.find("version=\"6\""));
+    ASSERT_EQ(std::string::npos, model.find("type=\"Parameter\""));
+
+    const std::map<std::string, std::string> config = {{CONFIG_KEY(CACHE_DIR), cacheDir}};
+    ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+    auto cachedNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+    ASSERT_EQ(1, CommonTestUtils::removeFilesWithExt(cacheDir, "blob"));
+
+    auto request = execNetwork.CreateInferRequest();
+    auto cachedRequest = cachedNetwork.CreateInferRequest();
+    for (const auto& input : execNetwork.GetInputsInfo()) {
+        auto blob = request.GetBlob(input.first);
+        auto data = blob->buffer().as<float*>();
+        for (size_t i = 0; i < blob->size(); i++) {
+            data[i] = static_cast<float>(i % 13) - 6.f;
+        }
+        cachedRequest.SetBlob(input.first, blob);
+    }
+    request.Infer();
+    cachedRequest.Infer();
+    for (const auto& output : execNetwork.GetOutputsInfo()) {
+        auto blob = request.GetBlob(output.first);
+        auto cachedBlob = cachedRequest.GetBlob(output.first);
+        ASSERT_EQ(blob->size(), cachedBlob->size());
+        auto data = blob->cbuffer().as<const float*>();
+        auto cachedData = cachedBlob->cbuffer().as<const float*>();
+        for (size_t i = 0; i < blob->size(); i++) {
+            ASSERT_NEAR(data[i], cachedData[i], 1e-5f) << "at " << i;
+        }
+    }
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,146 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* SSD-like head, the box and confidence branches keep the batch dimension,
+   so the network can be inferred for a part of the batch with DYN_BATCH_ENABLED
+
+    Param        Param
+      |            |
+   Transpose    Transpose
+      |            |
+   Reshape      Reshape     Const (priors)
+        \          |          /
+            DetectionOutput
+                   |
+                 Result
+*/
+class DynBatchDetectionOutputTest : public ::testing::Test {
+protected:
+    static constexpr size_t maxBatch = 4;
+    static constexpr size_t numClasses = 3;
+    static constexpr size_t featureSize = 2;
+    static constexpr size_t numPriors = featureSize * featureSize;
+    static constexpr int keepTopK = 10;
+
+    static InferenceEngine::CNNNetwork makeNetwork(size_t batch) {
+        auto loc = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{batch, 4, featureSize, featureSize});
+        loc->set_friendly_name("loc");
+        auto conf = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{batch, numClasses, featureSize, featureSize});
+        conf->set_friendly_name("conf");
+
+        auto flatten = [](const std::shared_ptr<ngraph::Node>& input) {
+            auto order = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{4}, {0, 2, 3, 1});
+            auto transpose = std::make_shared<ngraph::opset1::Transpose>(input, order);
+            auto pattern = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {0, -1});
+            return std::make_shared<ngraph::opset1::Reshape>(transpose, pattern, true);
+        };
+
+        // one prior per cell of the feature map followed by the variances of all priors
+        std::vector<float> priors;
+        for (size_t y = 0; y < featureSize; y++) {
+            for (size_t x = 0; x < featureSize; x++) {
+                const float xmin = 0.05f + 0.5f * x, ymin = 0.05f + 0.5f * y;
+                priors.insert(priors.end(), {xmin, ymin, xmin + 0.4f, ymin + 0.4f});
+            }
+        }
+        for (size_t p = 0; p < numPriors; p++) {
+            priors.insert(priors.end(), {0.1f, 0.1f, 0.2f, 0.2f});
+        }
+        auto priorBoxes = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 2, numPriors * 4}, priors);
+
+        ngraph::op::DetectionOutputAttrs attrs;
+        attrs.num_classes = numClasses;
+        attrs.background_label_id = 0;
+        attrs.top_k = keepTopK;
+        attrs.keep_top_k = {keepTopK};
+        attrs.code_type = "caffe.PriorBoxParameter.CENTER_SIZE";
+        attrs.nms_threshold = 0.5f;
+        attrs.confidence_threshold = 0.01f;
+        attrs.normalized = true;
+        auto detection = std::make_shared<ngraph::opset1::DetectionOutput>(flatten(loc), flatten(conf), priorBoxes, attrs);
+        detection->set_friendly_name("detection");
+
+        auto function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(detection)},
+                                                           ngraph::ParameterVector{loc, conf}, "DynBatchDetectionOutput");
+        return InferenceEngine::CNNNetwork(function);
+    }
+
+    // every image gets its own data, so detections of different images differ
+    static void fillInputs(InferenceEngine::InferRequest& request) {
+        auto loc = request.GetBlob("loc");
+        auto locData = loc->buffer().as<float*>();
+        for (size_t i = 0; i < loc->size(); i++) {
+            locData[i] = 0.1f * (static_cast<float>(i % 5) - 2.f);
+        }
+        auto conf = request.GetBlob("conf");
+        auto confData = conf->buffer().as<float*>();
+        for (size_t i = 0; i < conf->size(); i++) {
+            confData[i] = static_cast<float>((i * 7) % 11) / 11.f;
+        }
+    }
+
+    static void copyInputs(InferenceEngine::InferRequest& from, InferenceEngine::InferRequest& to) {
+        for (const auto& name : {"loc", "conf"}) {
+            auto src = from.GetBlob(name);
+            auto dst = to.GetBlob(name);
+            // the batch is the outermost dimension, so the first images are a prefix of the blob
+            ASSERT_LE(dst->byteSize(), src->byteSize());
+            std::memcpy(dst->buffer().as<void*>(), src->cbuffer().as<const void*>(), dst->byteSize());
+        }
+    }
+};
+
+TEST_F(DynBatchDetectionOutputTest, smoke_InferPartOfBatch) {
+    InferenceEngine::Core ie;
+    auto execNetwork = ie.LoadNetwork(makeNetwork(maxBatch), CommonTestUtils::DEVICE_CPU,
+                                      {{CONFIG_KEY(DYN_BATCH_ENABLED), CONFIG_VALUE(YES)}});
+    const auto outputName = execNetwork.GetOutputsInfo().begin()->first;
+
+    for (size_t batch = 1; batch < maxBatch; batch++) {
+        auto request = execNetwork.CreateInferRequest();
+        fillInputs(request);
+        request.SetBatch(static_cast<int>(batch));
+        request.Infer();
+
+        // the reference is the same network compiled for the processed batch
+        auto refNetwork = ie.LoadNetwork(makeNetwork(batch), CommonTestUtils::DEVICE_CPU);
+        auto refRequest = refNetwork.CreateInferRequest();
+        copyInputs(request, refRequest);
+        refRequest.Infer();
+
+        auto output = request.GetBlob(outputName);
+        auto refOutput = refRequest.GetBlob(outputName);
+        auto outputData = output->cbuffer().as<const float*>();
+        auto refData = refOutput->cbuffer().as<const float*>();
+        const size_t refRows = refOutput->size() / 7;
+        const size_t rows = output->size() / 7;
+        size_t row = 0;
+        for (; row < refRows && refData[row * 7] != -1.f; row++) {
+            for (size_t i = 0; i < 7; i++) {
+                ASSERT_NEAR(refData[row * 7 + i], outputData[row * 7 + i], 1e-5f) << "batch " << batch << " row " << row << " item " << i;
+            }
+        }
+        ASSERT_GT(row, 0u) << "batch " << batch;
+        // detections of the images beyond the processed batch are not reported
+        if (row < rows) {
+            ASSERT_EQ(-1.f, outputData[row * 7]) << "batch " << batch;
+        }
+    }
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,151 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <blob_factory.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* Input blobs of other dims make the request use a graph compiled for their shapes.
+
+    Param   Const
+        \   /
+       Multiply
+          |
+        Relu
+          |
+        Result
+*/
+class ShapeCacheTest : public ::testing::Test {
+protected:
+    static InferenceEngine::CNNNetwork makeNetwork() {
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 4, 4});
+        auto scales = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3, 1, 1}, {-1.f, 2.f, 3.f});
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(param, scales);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(multiply);
+        auto function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(relu)},
+                                                           ngraph::ParameterVector{param}, "ShapeCache");
+        return InferenceEngine::CNNNetwork(function);
+    }
+
+    static void inferAndCheck(InferenceEngine::InferRequest& request, const std::string& inputName, const std::string& outputName,
+                              const InferenceEngine::SizeVector& dims) {
+        auto input = make_blob_with_precision(InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, dims, InferenceEngine::Layout::NCHW));
+        input->allocate();
+        auto inputData = input->buffer().as<float*>();
+        for (size_t i = 0; i < input->size(); i++) {
+            inputData[i] = static_cast<float>(i % 7) - 3.f;
+        }
+        request.SetBlob(inputName, input);
+        request.Infer();
+
+        auto output = request.GetBlob(outputName);
+        ASSERT_EQ(dims, output->getTensorDesc().getDims());
+        const std::vector<float> scales = {-1.f, 2.f, 3.f};
+        const size_t spatial = dims[2] * dims[3];
+        auto outputData = output->cbuffer().as<const float*>();
+        for (size_t i = 0; i < output->size(); i++) {
+            ASSERT_FLOAT_EQ(std::max(0.f, inputData[i] * scales[(i / spatial) % 3]), outputData[i]) << "at " << i;
+        }
+    }
+};
+
+TEST_F(ShapeCacheTest, smoke_InferInputsOfOtherShapes) {
+    InferenceEngine::Core ie;
+    auto network = makeNetwork();
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto outputName = network.getOutputsInfo().begin()->first;
+    auto execNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                      {{InferenceEngine::PluginConfigParams::KEY_CPU_SHAPE_CACHE_CAPACITY, "1"}});
+    auto request = execNetwork.CreateInferRequest();
+
+    // switches to a new graph, evicts it, goes back to the loaded graph and compiles the evicted shapes again
+    inferAndCheck(request, inputName, outputName, {1, 3, 8, 8});
+    inferAndCheck(request, inputName, outputName, {2, 3, 5, 6});
+    inferAndCheck(request, inputName, outputName, {1, 3, 4, 4});
+    inferAndCheck(request, inputName, outputName, {1, 3, 8, 8});
+}
+
+TEST_F(ShapeCacheTest, smoke_DefaultOutputsAreReusedForCachedShapes) {
+    InferenceEngine::Core ie;
+    auto network = makeNetwork();
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto outputName = network.getOutputsInfo().begin()->first;
+    auto execNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                      {{InferenceEngine::PluginConfigParams::KEY_CPU_SHAPE_CACHE_CAPACITY, "1"}});
+    auto request = execNetwork.CreateInferRequest();
+
+    inferAndCheck(request, inputName, outputName, {1, 3, 4, 4});
+    auto loadedOutput = request.GetBlob(outputName);
+    inferAndCheck(request, inputName, outputName, {1, 3, 8, 8});
+    auto otherOutput = request.GetBlob(outputName);
+    ASSERT_NE(loadedOutput, otherOutput);
+
+    inferAndCheck(request, inputName, outputName, {1, 3, 4, 4});
+    ASSERT_EQ(loadedOutput, request.GetBlob(outputName));
+    inferAndCheck(request, inputName, outputName, {1, 3, 8, 8});
+    ASSERT_EQ(otherOutput, request.GetBlob(outputName));
+}
+
+TEST_F(ShapeCacheTest, smoke_UserOutputsAreKept) {
+    InferenceEngine::Core ie;
+    auto network = makeNetwork();
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto outputName = network.getOutputsInfo().begin()->first;
+    auto execNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                      {{InferenceEngine::PluginConfigParams::KEY_CPU_SHAPE_CACHE_CAPACITY, "1"}});
+    auto request = execNetwork.CreateInferRequest();
+
+    auto output = make_blob_with_precision(InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {1, 3, 8, 8}, InferenceEngine::Layout::NCHW));
+    output->allocate();
+    request.SetBlob(outputName, output);
+    inferAndCheck(request, inputName, outputName, {1, 3, 8, 8});
+    ASSERT_EQ(output, request.GetBlob(outputName));
+
+    // the output set by the user doesn't match the output of the loaded shapes
+    auto input = make_blob_with_precision(InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {1, 3, 4, 4}, InferenceEngine::Layout::NCHW));
+    input->allocate();
+    request.SetBlob(inputName, input);
+    ASSERT_THROW(request.Infer(), InferenceEngine::details::InferenceEngineException);
+    ASSERT_EQ(output, request.GetBlob(outputName));
+}
+
+TEST_F(ShapeCacheTest, smoke_InputsOfOtherShapesAreRejectedByDefault) {
+    InferenceEngine::Core ie;
+    auto network = makeNetwork();
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto execNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto request = execNetwork.CreateInferRequest();
+
+    auto input = make_blob_with_precision(InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {1, 3, 8, 8}, InferenceEngine::Layout::NCHW));
+    input->allocate();
+    ASSERT_THROW(request.SetBlob(inputName, input), InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(ShapeCacheTest, smoke_InputsOfOtherRankOrPrecisionAreRejected) {
+    InferenceEngine::Core ie;
+    auto network = makeNetwork();
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto execNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                      {{InferenceEngine::PluginConfigParams::KEY_CPU_SHAPE_CACHE_CAPACITY, "1"}});
+    auto request = execNetwork.CreateInferRequest();
+
+    auto otherRank = make_blob_with_precision(InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {3, 8, 8}, InferenceEngine::Layout::CHW));
+    otherRank->allocate();
+    ASSERT_THROW(request.SetBlob(inputName, otherRank), InferenceEngine::details::InferenceEngineException);
+
+    auto otherPrecision = make_blob_with_precision(InferenceEngine::TensorDesc(InferenceEngine::Precision::I32, {1, 3, 8, 8}, InferenceEngine::Layout::NCHW));
+    otherPrecision->allocate();
+    ASSERT_THROW(request.SetBlob(inputName, otherPrecision), InferenceEngine::details::InferenceEngineException);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
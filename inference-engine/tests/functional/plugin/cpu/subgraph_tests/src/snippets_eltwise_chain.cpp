@@ -0,0 +1,106 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using ngraph::helpers::EltwiseTypes;
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<std::vector<size_t>>,        // Input shapes
+        std::vector<EltwiseTypes>,               // Eltwise operations
+        std::string                              // Device name
+> SnippetsEltwiseChainTuple;
+
+/* The chain is collapsed into a single Subgraph node executed by a generated kernel.
+
+    Param0   Param1
+        \     /
+        Eltwise0   Param2
+             \     /
+             Eltwise1
+                |
+              Tanh
+                |
+              Result
+*/
+class SnippetsEltwiseChainTest : public testing::WithParamInterface<SnippetsEltwiseChainTuple>,
+                                 virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SnippetsEltwiseChainTuple> &obj) {
+        std::vector<std::vector<size_t>> inputShapes;
+        std::vector<EltwiseTypes> eltwiseOpTypes;
+        std::string targetName;
+        std::tie(inputShapes, eltwiseOpTypes, targetName) = obj.param;
+        std::ostringstream results;
+
+        for (int i = 0; i < inputShapes.size(); i++) {
+            results << "IS" << std::to_string(i) << "=" << CommonTestUtils::vec2str(inputShapes[i]) << "_";
+        }
+        for (int i = 0; i < eltwiseOpTypes.size(); i++) {
+            results << "Op" << std::to_string(i) << "=" << eltwiseOpTypes[i] << "_";
+        }
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() {
+        std::vector<std::vector<size_t>> inputShapes;
+        std::vector<EltwiseTypes> eltwiseOpTypes;
+        std::tie(inputShapes, eltwiseOpTypes, targetDevice) = this->GetParam();
+        configuration.insert({InferenceEngine::PluginConfigParams::KEY_CPU_SNIPPETS, InferenceEngine::PluginConfigParams::YES});
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, inputShapes);
+        auto eltwise0 = ngraph::builder::makeEltwise(params[0], params[1], eltwiseOpTypes[0]);
+        auto eltwise1 = ngraph::builder::makeEltwise(eltwise0, params[2], eltwiseOpTypes[1]);
+        auto tanh = std::make_shared<ngraph::opset1::Tanh>(eltwise1);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(tanh)};
+        function = std::make_shared<ngraph::Function>(results, params, "snippets_eltwise_chain");
+    }
+};
+
+TEST_P(SnippetsEltwiseChainTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Subgraph", 1);
+}
+
+namespace {
+
+std::vector<std::vector<std::vector<size_t>>> inputShapes {
+        {{1, 16, 10, 10}, {1, 16, 10, 10}, {1, 16, 10, 10}},
+        {{1, 16, 10, 10}, {1, 16, 1, 1}, {1, 1, 10, 10}},
+        {{2, 3, 5, 17}, {2, 3, 5, 1}, {2, 3, 5, 17}},
+        {{3, 7, 11}, {7, 11}, {11}},
+        {{1, 3, 4, 5, 19}, {1, 3, 1, 5, 19}, {1, 1, 4, 5, 1}},
+};
+
+std::vector<std::vector<EltwiseTypes>> eltwiseOps = {
+        { EltwiseTypes::ADD, EltwiseTypes::MULTIPLY },
+        { EltwiseTypes::SUBTRACT, EltwiseTypes::SQUARED_DIFF },
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_SnippetsEltwiseChain, SnippetsEltwiseChainTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::ValuesIn(eltwiseOps),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        SnippetsEltwiseChainTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
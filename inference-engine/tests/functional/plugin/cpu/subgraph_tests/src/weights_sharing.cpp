@@ -0,0 +1,120 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* Networks loaded to the plugin share their weights through the plugin-wide cache.
+   The networks below have the same topology and layer names, only the weights differ.
+
+    Param   Const
+        \   /
+     Convolution
+          |
+        Result
+*/
+class WeightsSharingTest : public ::testing::Test {
+protected:
+    static constexpr size_t inChannels = 3;
+    static constexpr size_t outChannels = 16;
+    static constexpr size_t spatial = 8 * 8;
+
+    static std::vector<float> makeWeights(float scale) {
+        std::vector<float> weights(outChannels * inChannels);
+        for (size_t i = 0; i < weights.size(); i++) {
+            weights[i] = scale * (static_cast<float>(i % 5) - 2.f);
+        }
+        return weights;
+    }
+
+    static InferenceEngine::CNNNetwork makeNetwork(const std::vector<float>& weights) {
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, inChannels, 8, 8});
+        param->set_friendly_name("input");
+        auto filters = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{outChannels, inChannels, 1, 1}, weights);
+        filters->set_friendly_name("weights");
+        auto conv = std::make_shared<ngraph::opset1::Convolution>(param, filters, ngraph::Strides{1, 1},
+                                                                  ngraph::CoordinateDiff{0, 0}, ngraph::CoordinateDiff{0, 0},
+                                                                  ngraph::Strides{1, 1});
+        conv->set_friendly_name("conv");
+        auto result = std::make_shared<ngraph::opset1::Result>(conv);
+        result->set_friendly_name("output");
+        return InferenceEngine::CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result},
+                                                                              ngraph::ParameterVector{param}, "WeightsSharing"));
+    }
+
+    static void checkInfer(InferenceEngine::ExecutableNetwork& execNetwork, const std::vector<float>& weights) {
+        auto request = execNetwork.CreateInferRequest();
+        auto input = request.GetBlob(execNetwork.GetInputsInfo().begin()->first);
+        auto inputData = input->buffer().as<float*>();
+        for (size_t i = 0; i < input->size(); i++) {
+            inputData[i] = static_cast<float>(i % 7) - 3.f;
+        }
+        request.Infer();
+
+        auto output = request.GetBlob(execNetwork.GetOutputsInfo().begin()->first);
+        auto outputData = output->cbuffer().as<const float*>();
+        for (size_t o = 0; o < outChannels; o++) {
+            for (size_t p = 0; p < spatial; p++) {
+                float expected = 0.f;
+                for (size_t c = 0; c < inChannels; c++) {
+                    expected += weights[o * inChannels + c] * inputData[c * spatial + p];
+                }
+                ASSERT_FLOAT_EQ(expected, outputData[o * spatial + p]) << "channel " << o << " at " << p;
+            }
+        }
+    }
+};
+
+TEST_F(WeightsSharingTest, smoke_NetworksWithSameWeightsShareThem) {
+    InferenceEngine::Core ie;
+    const std::map<std::string, std::string> config = {{CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "2"}};
+    auto weights = makeWeights(1.f);
+    auto execNetwork1 = ie.LoadNetwork(makeNetwork(weights), CommonTestUtils::DEVICE_CPU, config);
+    auto execNetwork2 = ie.LoadNetwork(makeNetwork(weights), CommonTestUtils::DEVICE_CPU, config);
+    checkInfer(execNetwork1, weights);
+    checkInfer(execNetwork2, weights);
+}
+
+// the networks differ in the weights only, each of them has to use its own ones
+TEST_F(WeightsSharingTest, smoke_NetworksWithOtherWeightsDoNotShareThem) {
+    InferenceEngine::Core ie;
+    const std::map<std::string, std::string> config = {{CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "2"}};
+    auto weights1 = makeWeights(1.f);
+    auto weights2 = makeWeights(-2.f);
+    auto execNetwork1 = ie.LoadNetwork(makeNetwork(weights1), CommonTestUtils::DEVICE_CPU, config);
+    auto execNetwork2 = ie.LoadNetwork(makeNetwork(weights2), CommonTestUtils::DEVICE_CPU, config);
+    checkInfer(execNetwork1, weights1);
+    checkInfer(execNetwork2, weights2);
+
+    // the first network is released, the weights of a new one must not be taken from the second one
+    execNetwork1 = {};
+    auto execNetwork3 = ie.LoadNetwork(makeNetwork(weights1), CommonTestUtils::DEVICE_CPU, config);
+    checkInfer(execNetwork3, weights1);
+    checkInfer(execNetwork2, weights2);
+}
+
+// the cache is used for the default single stream as well
+TEST_F(WeightsSharingTest, smoke_SingleStreamNetworksWithOtherWeightsDoNotShareThem) {
+    InferenceEngine::Core ie;
+    auto weights1 = makeWeights(1.f);
+    auto weights2 = makeWeights(-2.f);
+    auto execNetwork1 = ie.LoadNetwork(makeNetwork(weights1), CommonTestUtils::DEVICE_CPU);
+    auto execNetwork2 = ie.LoadNetwork(makeNetwork(weights2), CommonTestUtils::DEVICE_CPU);
+    auto execNetwork3 = ie.LoadNetwork(makeNetwork(weights1), CommonTestUtils::DEVICE_CPU);
+    checkInfer(execNetwork1, weights1);
+    checkInfer(execNetwork2, weights2);
+    checkInfer(execNetwork3, weights1);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -161,6 +161,8 @@ using IEClassExecutableNetworkGetMetricTest_SUPPORTED_CONFIG_KEYS = IEClassBaseT
 using IEClassExecutableNetworkGetMetricTest_SUPPORTED_METRICS = IEClassBaseTestP;
 using IEClassExecutableNetworkGetMetricTest_NETWORK_NAME = IEClassBaseTestP;
 using IEClassExecutableNetworkGetMetricTest_OPTIMAL_NUMBER_OF_INFER_REQUESTS = IEClassBaseTestP;
+using IEClassExecutableNetworkGetMetricTest_PEAK_MEMORY_ARENA_SIZE = IEClassBaseTestP;
+using IEClassExecutableNetworkGetMetricTest_MEMORY_SOLVER_STATISTICS = IEClassBaseTestP;
 using IEClassExecutableNetworkGetMetricTest_ThrowsUnsupported = IEClassBaseTestP;
 using IEClassExecutableNetworkGetConfigTest = IEClassBaseTestP;
 using IEClassExecutableNetworkSetConfigTest = IEClassBaseTestP;
@@ -1002,6 +1004,38 @@ TEST_P(IEClassExecutableNetworkGetMetricTest_OPTIMAL_NUMBER_OF_INFER_REQUESTS, G
     ASSERT_EXEC_METRIC_SUPPORTED(EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
 }
 
+TEST_P(IEClassExecutableNetworkGetMetricTest_PEAK_MEMORY_ARENA_SIZE, GetMetricNoThrow) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    Core ie;
+    Parameter p;
+
+    ExecutableNetwork exeNetwork = ie.LoadNetwork(simpleNetwork, deviceName);
+    InferRequest request = exeNetwork.CreateInferRequest();
+
+    ASSERT_NO_THROW(p = exeNetwork.GetMetric(EXEC_NETWORK_METRIC_KEY(PEAK_MEMORY_ARENA_SIZE)));
+    uint64_t value = p;
+
+    std::cout << "Peak memory arena size: " << value << std::endl;
+    ASSERT_GT(value, 0u);
+    ASSERT_EXEC_METRIC_SUPPORTED(EXEC_NETWORK_METRIC_KEY(PEAK_MEMORY_ARENA_SIZE));
+}
+
+TEST_P(IEClassExecutableNetworkGetMetricTest_MEMORY_SOLVER_STATISTICS, GetMetricNoThrow) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    Core ie;
+    Parameter p;
+
+    ExecutableNetwork exeNetwork = ie.LoadNetwork(simpleNetwork, deviceName);
+
+    ASSERT_NO_THROW(p = exeNetwork.GetMetric(EXEC_NETWORK_METRIC_KEY(MEMORY_SOLVER_STATISTICS)));
+    std::map<std::string, uint64_t> statistics = p;
+
+    std::cout << "Memory workspace size: " << statistics["SOLVED_SIZE"]
+              << ", lower bound: " << statistics["LOWER_BOUND"] << std::endl;
+    ASSERT_GE(statistics["SOLVED_SIZE"], statistics["LOWER_BOUND"]);
+    ASSERT_EXEC_METRIC_SUPPORTED(EXEC_NETWORK_METRIC_KEY(MEMORY_SOLVER_STATISTICS));
+}
+
 TEST_P(IEClassExecutableNetworkGetMetricTest_ThrowsUnsupported, GetMetricThrow) {
     SKIP_IF_CURRENT_TEST_IS_DISABLED();
     Core ie;
@@ -273,3 +273,66 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+
+TEST(MemSolverTest, BestFitSolvesUnefficiency) {
+    std::vector<Box> boxes{    //  |            __________
+            {6, 7, 3, 0},      //  |   ____    |_3________|
+            {2, 5, 2, 1},      //  |  |_4__|_____ |    |
+            {5, 8, 2, 2},      //  |__|_2________||_1__|___
+            {2, 3, 2, 3},      //      2  3  4  5  6  7  8
+    };
+
+    MKLDNNPlugin::MemorySolver ms(boxes, MKLDNNPlugin::MemorySolver::Strategy::BestFit);
+    EXPECT_EQ(ms.solve(), 5);
+    EXPECT_EQ(ms.maxDepth(), 5);
+}
+
+TEST(MemSolverTest, BestFitNoOverlapping) {
+    int n = 0;                //  |         _____________
+    std::vector<Box> boxes{   //  |   _____|___1_________|
+            {4, 8, 1, n++},   //  |  |_2_____|    ____
+            {6, 7, 3, n++},   //  |  |    |      |    |
+            {2, 3, 3, n++},   //  |__|_3__|______|_3__|___
+            {2, 4, 2, n++},   //      2  3  4  5  6  7  8
+    };
+
+    MKLDNNPlugin::MemorySolver ms(boxes, MKLDNNPlugin::MemorySolver::Strategy::BestFit);
+    EXPECT_EQ(ms.solve(), 5);
+
+    auto no_overlap = [&](Box box1, Box box2) -> bool {
+        int off1 = ms.getOffset(box1.id);
+        int off2 = ms.getOffset(box2.id);
+        return box1.finish < box2.start || box1.start > box2.finish ||
+               off1 + box1.size <= off2 || off1 >= off2 + box2.size;
+    };
+
+    for (int i = 0; i < n; i++)
+        for (int j = i + 1; j < n; j++)
+            ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
+}
+
+TEST(MemSolverTest, BestFitIsNotWorseThanGreedy) {
+    std::vector<Box> boxes;
+    int n = 0;
+    for (int i = 0; i < 50; i++) {
+        int start = (i * 7) % 23;
+        boxes.push_back({start, start + (i * 5) % 11, 1 + (i * 13) % 17, n++});
+    }
+
+    MKLDNNPlugin::MemorySolver greedy(boxes);
+    MKLDNNPlugin::MemorySolver best_fit(boxes, MKLDNNPlugin::MemorySolver::Strategy::BestFit);
+    auto best_fit_size = best_fit.solve();
+    EXPECT_LE(best_fit_size, greedy.solve());
+    EXPECT_GE(best_fit_size, best_fit.maxDepth());
+
+    for (int i = 0; i < n; i++) {
+        for (int j = i + 1; j < n; j++) {
+            const auto& b1 = boxes[i];
+            const auto& b2 = boxes[j];
+            auto off1 = best_fit.getOffset(b1.id);
+            auto off2 = best_fit.getOffset(b2.id);
+            ASSERT_TRUE(b1.finish < b2.start || b1.start > b2.finish ||
+                        off1 + b1.size <= off2 || off1 >= off2 + b2.size) << "Box overlapping is detected";
+        }
+    }
+}
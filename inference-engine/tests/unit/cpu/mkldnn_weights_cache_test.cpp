@@ -0,0 +1,90 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_weights_cache.hpp"
+
+using MKLDNNPlugin::SimpleDataHash;
+
+namespace {
+
+// Byte-at-a-time ECMA-182 CRC64 the cache keys were computed with before
+uint64_t referenceHash(const unsigned char* data, size_t size) {
+    uint64_t table[256];
+    for (int i = 0; i < 256; i++) {
+        uint64_t c = i;
+        for (int j = 0; j < 8; j++)
+            c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
+        table[i] = c;
+    }
+    uint64_t crc = 0;
+    for (size_t idx = 0; idx < size; idx++)
+        crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
+    return ~crc;
+}
+
+std::vector<unsigned char> randomData(size_t size) {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(0, 255);
+    std::vector<unsigned char> data(size);
+    for (auto& byte : data)
+        byte = static_cast<unsigned char>(distribution(generator));
+    return data;
+}
+
+}  // namespace
+
+TEST(SimpleDataHashTest, MatchesReferenceForSmallSizes) {
+    SimpleDataHash hash;
+    auto data = randomData(64);
+    for (size_t size = 0; size <= data.size(); size++) {
+        EXPECT_EQ(referenceHash(data.data(), size), hash.hash(data.data(), size)) << "size " << size;
+    }
+}
+
+TEST(SimpleDataHashTest, MatchesReferenceForUnalignedData) {
+    SimpleDataHash hash;
+    auto data = randomData(1024);
+    for (size_t offset = 1; offset < 8; offset++) {
+        EXPECT_EQ(referenceHash(data.data() + offset, data.size() - offset),
+                  hash.hash(data.data() + offset, data.size() - offset)) << "offset " << offset;
+    }
+}
+
+TEST(SimpleDataHashTest, ParallelHashMatchesSerial) {
+    SimpleDataHash hash;
+    auto data = randomData((16 << 20) + 13);
+    for (size_t size : {size_t(1 << 20), size_t(3 << 20) + 1, data.size()}) {
+        auto expected = referenceHash(data.data(), size);
+        EXPECT_EQ(expected, hash.serialHash(data.data(), size)) << "size " << size;
+        EXPECT_EQ(expected, hash.hash(data.data(), size)) << "size " << size;
+    }
+}
+
+// Microbenchmark, run with --gtest_also_run_disabled_tests
+TEST(SimpleDataHashTest, DISABLED_Performance) {
+    SimpleDataHash hash;
+    auto data = randomData(256 << 20);
+
+    auto measure = [&](const char* name, std::function<uint64_t()> hashFunc) {
+        const int iterations = 5;
+        uint64_t result = hashFunc();  // warm up
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++)
+            result ^= hashFunc();
+        auto time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / iterations;
+        std::cout << name << ": " << data.size() / time / (1 << 30) << " GB/s" << std::endl;
+        return result;
+    };
+
+    measure("byte-at-a-time", [&] { return referenceHash(data.data(), data.size()); });
+    measure("slicing-by-8", [&] { return hash.serialHash(data.data(), data.size()); });
+    measure("parallel slicing-by-8", [&] { return hash.hash(data.data(), data.size()); });
+}
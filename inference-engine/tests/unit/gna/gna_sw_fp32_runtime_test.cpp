@@ -0,0 +1,318 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+// the software FP32 runtime is built without MKL
+#ifndef _NO_MKL_
+#define _NO_MKL_
+#endif
+#include "runtime/cnn.h"
+#include "runtime/floatmath.h"
+#include "runtime/floatmath_dot.hpp"
+#include "runtime/pwl.h"
+
+// the kernels of every cross compiled instruction set, the plugin calls the one chosen by the dispatcher
+namespace GNAPluginNS {
+namespace runtime {
+namespace ANY {
+void dot_rows(const float* rows, size_t row_stride, size_t num_rows,
+              const float* vecs, size_t vec_stride, size_t num_vecs, size_t size,
+              float* out, size_t out_row_stride, size_t out_vec_stride);
+}  // namespace ANY
+#ifdef GNA_CROSS_COMPILED_AVX2
+namespace AVX2 {
+void dot_rows(const float* rows, size_t row_stride, size_t num_rows,
+              const float* vecs, size_t vec_stride, size_t num_vecs, size_t size,
+              float* out, size_t out_row_stride, size_t out_vec_stride);
+}  // namespace AVX2
+#endif
+#ifdef GNA_CROSS_COMPILED_AVX512F
+namespace AVX512F {
+void dot_rows(const float* rows, size_t row_stride, size_t num_rows,
+              const float* vecs, size_t vec_stride, size_t num_vecs, size_t size,
+              float* out, size_t out_row_stride, size_t out_vec_stride);
+}  // namespace AVX512F
+#endif
+}  // namespace runtime
+}  // namespace GNAPluginNS
+
+// The kernels of the software FP32 runtime are compared with plain scalar loops.
+// The summation order of the kernels differs, so the products match within a tolerance.
+
+namespace {
+
+constexpr float tolerance = 1e-4f;
+
+std::vector<float> randomData(size_t size, float low = -1.f, float high = 1.f) {
+    static std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(low, high);
+    std::vector<float> data(size);
+    for (auto& value : data) {
+        value = distribution(generator);
+    }
+    return data;
+}
+
+void expectNear(const std::vector<float>& expected, const std::vector<float>& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_NEAR(expected[i], actual[i], tolerance) << "at " << i;
+    }
+}
+
+using DotRows = decltype(&GNAPluginNS::runtime::ANY::dot_rows);
+
+// the kernels the host can run
+std::vector<std::pair<std::string, DotRows>> supportedDotRows() {
+    std::vector<std::pair<std::string, DotRows>> kernels{{"ANY", &GNAPluginNS::runtime::ANY::dot_rows}};
+#ifdef GNA_CROSS_COMPILED_AVX2
+    if (InferenceEngine::with_cpu_x86_avx2()) {
+        kernels.emplace_back("AVX2", &GNAPluginNS::runtime::AVX2::dot_rows);
+    }
+#endif
+#ifdef GNA_CROSS_COMPILED_AVX512F
+    if (InferenceEngine::with_cpu_x86_avx512f()) {
+        kernels.emplace_back("AVX512F", &GNAPluginNS::runtime::AVX512F::dot_rows);
+    }
+#endif
+    return kernels;
+}
+
+struct DotRowsParams {
+    size_t rows, vecs, size;
+};
+
+class GNADotRowsTest : public ::testing::TestWithParam<DotRowsParams> {};
+
+TEST_P(GNADotRowsTest, dotRowsMatchesReference) {
+    const auto p = GetParam();
+    // the rows and the vectors are padded, the outputs are interleaved as the transposed ones of sgemm
+    const size_t stride = p.size + 3;
+    const auto rows = randomData(p.rows * stride);
+    const auto vecs = randomData(p.vecs * stride);
+    const auto initial = randomData(p.rows * p.vecs);
+
+    auto expected = initial;
+    for (size_t i = 0; i < p.rows; i++) {
+        for (size_t v = 0; v < p.vecs; v++) {
+            float sum = 0.f;
+            for (size_t k = 0; k < p.size; k++) {
+                sum += rows[i * stride + k] * vecs[v * stride + k];
+            }
+            expected[i * p.vecs + v] += sum;
+        }
+    }
+
+    for (const auto& kernel : supportedDotRows()) {
+        SCOPED_TRACE(kernel.first);
+        auto actual = initial;
+        kernel.second(rows.data(), stride, p.rows, vecs.data(), stride, p.vecs, p.size, actual.data(), p.vecs, 1);
+        expectNear(expected, actual);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(GNADotRows, GNADotRowsTest, ::testing::Values(
+    // shorter than a vector register
+    DotRowsParams{3, 1, 1},
+    DotRowsParams{3, 2, 7},
+    // the tails after the unrolled loops of AVX2 and AVX512F
+    DotRowsParams{4, 3, 8},
+    DotRowsParams{4, 3, 15},
+    DotRowsParams{2, 2, 16},
+    DotRowsParams{2, 2, 17},
+    DotRowsParams{5, 4, 31},
+    DotRowsParams{5, 4, 32},
+    DotRowsParams{5, 4, 47},
+    DotRowsParams{7, 3, 440}));
+
+// row-major C = (beta == 1 ? C : 0) + A * B for the rows of A from the list
+void sgemmReference(int N, int K, const float* A, int lda, const float* B, int ldb, float beta, float* C, int ldc,
+                    const std::vector<uint32_t>& rows) {
+    for (size_t l = 0; l < rows.size(); l++) {
+        for (int j = 0; j < N; j++) {
+            float sum = (beta == 1.f) ? C[l * ldc + j] : 0.f;
+            for (int k = 0; k < K; k++) {
+                sum += A[rows[l] * lda + k] * B[k * ldb + j];
+            }
+            C[l * ldc + j] = sum;
+        }
+    }
+}
+
+struct SgemmParams {
+    int M, N, K, lda, ldb, ldc;
+    float beta;
+};
+
+class GNASgemmTest : public ::testing::TestWithParam<SgemmParams> {};
+
+TEST_P(GNASgemmTest, sgemmMatchesReference) {
+    const auto p = GetParam();
+    const auto A = randomData(static_cast<size_t>(p.M) * p.lda);
+    const auto B = randomData(static_cast<size_t>(p.K) * p.ldb);
+    auto expected = randomData(static_cast<size_t>(p.M) * p.ldc);
+    auto actual = expected;
+
+    std::vector<uint32_t> allRows(p.M);
+    for (int i = 0; i < p.M; i++) {
+        allRows[i] = i;
+    }
+    sgemmReference(p.N, p.K, A.data(), p.lda, B.data(), p.ldb, p.beta, expected.data(), p.ldc, allRows);
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, p.M, p.N, p.K, 1.0f, A.data(), p.lda, B.data(), p.ldb,
+                 p.beta, actual.data(), p.ldc);
+    expectNear(expected, actual);
+}
+
+TEST_P(GNASgemmTest, sgemmSubsetMatchesReference) {
+    const auto p = GetParam();
+    const auto A = randomData(static_cast<size_t>(p.M) * p.lda);
+    const auto B = randomData(static_cast<size_t>(p.K) * p.ldb);
+    // every other row of A in the reverse order
+    std::vector<uint32_t> outputList;
+    for (int i = p.M - 1; i >= 0; i -= 2) {
+        outputList.push_back(i);
+    }
+    const auto L = static_cast<int>(outputList.size());
+    auto expected = randomData(static_cast<size_t>(L) * p.ldc);
+    auto actual = expected;
+
+    sgemmReference(p.N, p.K, A.data(), p.lda, B.data(), p.ldb, p.beta, expected.data(), p.ldc, outputList);
+    cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, p.M, p.N, p.K, 1.0f, A.data(), p.lda, B.data(), p.ldb,
+                       p.beta, actual.data(), p.ldc, outputList.data(), L);
+    expectNear(expected, actual);
+}
+
+INSTANTIATE_TEST_CASE_P(GNASgemm, GNASgemmTest, ::testing::Values(
+    // a single vector, computed by the calling thread
+    SgemmParams{7, 1, 17, 17, 1, 1, 1.f},
+    SgemmParams{7, 1, 17, 20, 1, 3, 0.f},
+    // several vectors with ldb != N, the columns of B are gathered
+    SgemmParams{13, 3, 33, 40, 5, 4, 1.f},
+    SgemmParams{13, 3, 33, 33, 8, 3, 0.f},
+    // large enough to be split between threads
+    SgemmParams{100, 4, 120, 128, 6, 4, 1.f},
+    SgemmParams{257, 8, 440, 440, 8, 11, 0.f}));
+
+#if GNA_LIB_VER == 2
+struct Conv2DParams {
+    uint32_t IH, IW, IC, KH, KW, OC, strideH, strideW, padH, padW;
+};
+
+class GNAConv2DTest : public ::testing::TestWithParam<Conv2DParams> {};
+
+TEST_P(GNAConv2DTest, conv2DMatchesReference) {
+    const auto p = GetParam();
+    const uint32_t OH = (p.IH + 2 * p.padH - p.KH) / p.strideH + 1;
+    const uint32_t OW = (p.IW + 2 * p.padW - p.KW) / p.strideW + 1;
+    // every kernel is aligned to 4 floats
+    const uint32_t kernelStride = (p.KH * p.KW * p.IC + 3) / 4 * 4;
+
+    const auto filters = randomData(p.OC * kernelStride);
+    const auto biases = randomData(p.OC);
+    auto inputs = randomData(p.IH * p.IW * p.IC);
+
+    // NHWC input and output, OHWI filters
+    std::vector<float> expected(OH * OW * p.OC);
+    for (uint32_t oh = 0; oh < OH; oh++) {
+        for (uint32_t ow = 0; ow < OW; ow++) {
+            for (uint32_t oc = 0; oc < p.OC; oc++) {
+                float sum = biases[oc];
+                for (uint32_t kh = 0; kh < p.KH; kh++) {
+                    for (uint32_t kw = 0; kw < p.KW; kw++) {
+                        const auto ih = static_cast<int64_t>(oh * p.strideH + kh) - p.padH;
+                        const auto iw = static_cast<int64_t>(ow * p.strideW + kw) - p.padW;
+                        if (ih < 0 || ih >= p.IH || iw < 0 || iw >= p.IW) {
+                            continue;
+                        }
+                        for (uint32_t c = 0; c < p.IC; c++) {
+                            sum += filters[oc * kernelStride + (kh * p.KW + kw) * p.IC + c] *
+                                   inputs[(ih * p.IW + iw) * p.IC + c];
+                        }
+                    }
+                }
+                expected[(oh * OW + ow) * p.OC + oc] = sum;
+            }
+        }
+    }
+
+    std::vector<float> actual(expected.size());
+    intel_dnn_component_t component{};
+    component.original_layer_name = "conv2d";
+    component.tensors = {{{1, p.IH, p.IW, p.IC}}, {{1, OH, OW, p.OC}}, {{p.OC, p.KH, p.KW, p.IC}}};
+    component.op.conv2D.convStride = {p.strideH, p.strideW};
+    component.op.conv2D.zeroPadding = {p.padH, p.padW};
+    component.op.conv2D.ptr_filters = const_cast<float*>(filters.data());
+    component.op.conv2D.ptr_biases = const_cast<float*>(biases.data());
+    component.ptr_inputs = inputs.data();
+    component.ptr_outputs = actual.data();
+    CNN2DFilter32(&component);
+    expectNear(expected, actual);
+}
+
+INSTANTIATE_TEST_CASE_P(GNAConv2D, GNAConv2DTest, ::testing::Values(
+    Conv2DParams{5, 11, 3, 1, 1, 4, 1, 1, 0, 0},
+    Conv2DParams{9, 11, 8, 3, 5, 4, 1, 1, 0, 0},
+    // the taps of the border outputs fall into the padding on both sides
+    Conv2DParams{5, 4, 3, 3, 2, 4, 1, 1, 1, 1},
+    Conv2DParams{9, 11, 1, 3, 5, 1, 1, 1, 2, 2},
+    // the padding is larger than the part of the filter before the input
+    Conv2DParams{1, 4, 8, 3, 5, 4, 1, 1, 2, 2},
+    // strided
+    Conv2DParams{9, 11, 3, 3, 2, 4, 2, 2, 0, 0},
+    Conv2DParams{9, 11, 3, 3, 5, 4, 2, 1, 1, 2},
+    Conv2DParams{16, 16, 8, 3, 3, 16, 2, 2, 1, 1}));
+#endif
+
+struct PwlParams {
+    uint32_t rows, columns;
+    uint32_t rowStart, rowEnd, columnStart, columnEnd;
+};
+
+class GNAPwlTest : public ::testing::TestWithParam<PwlParams> {};
+
+TEST_P(GNAPwlTest, sigmoidMatchesReference) {
+    const auto p = GetParam();
+    auto inputs = randomData(p.rows * p.columns, -8.f, 8.f);
+    // the elements outside of the applied range keep their values
+    std::vector<float> expected(inputs.size(), -1.f);
+    for (uint32_t i = p.rowStart; i <= p.rowEnd; i++) {
+        for (uint32_t j = p.columnStart; j <= p.columnEnd; j++) {
+            expected[i * p.columns + j] = 0.5 * (1.0 + tanh(0.5 * inputs[i * p.columns + j]));
+        }
+    }
+
+    std::vector<float> actual(inputs.size(), -1.f);
+    intel_dnn_component_t component{};
+    component.original_layer_name = "sigmoid";
+    component.num_rows_in = p.rows;
+    component.num_columns_in = p.columns;
+    component.op.pwl.func_id = DnnActivation::fromType(kActSigmoid);
+    component.ptr_inputs = inputs.data();
+    component.ptr_outputs = actual.data();
+    PwlApply32(&component, p.rowStart, p.rowEnd, p.columnStart, p.columnEnd);
+    // the same libm calls are made for every element, only the split between threads differs
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(expected[i], actual[i]) << "at " << i;
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(GNAPwl, GNAPwlTest, ::testing::Values(
+    // below PWL_PARALLEL_MIN_SIZE
+    PwlParams{4, 100, 0, 3, 0, 99},
+    // a single row is split by columns
+    PwlParams{1, PWL_PARALLEL_MIN_SIZE + 123, 0, 0, 0, PWL_PARALLEL_MIN_SIZE + 122},
+    PwlParams{1, 2 * PWL_PARALLEL_MIN_SIZE, 0, 0, 17, 2 * PWL_PARALLEL_MIN_SIZE - 5},
+    // several rows are split by rows
+    PwlParams{8, 1000, 0, 7, 0, 999},
+    PwlParams{8, 1000, 1, 6, 10, 990}));
+
+}  // namespace
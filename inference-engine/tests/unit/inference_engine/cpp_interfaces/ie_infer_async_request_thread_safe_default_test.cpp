@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <cstdlib>
 #include <deque>
+#include <new>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
@@ -11,6 +14,7 @@
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
 #include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
 #include <threading/ie_cpu_streams_executor.hpp>
+#include <threading/ie_immediate_executor.hpp>
 
 #include "unit_test_utils/mocks/cpp_interfaces/mock_task_executor.hpp"
 #include "unit_test_utils/mocks/cpp_interfaces/impl/mock_infer_request_internal.hpp"
@@ -21,6 +25,26 @@ using namespace std;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+std::atomic<bool> countAllocations{false};
+std::atomic<std::size_t> allocationsCount{0};
+}  // namespace
+
+// Counts allocations of the test process while countAllocations is set
+void* operator new(std::size_t size) {
+    if (countAllocations) {
+        ++allocationsCount;
+    }
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
 struct DeferedExecutor : public ITaskExecutor {
     using Ptr = std::shared_ptr<DeferedExecutor>;
     DeferedExecutor() = default;
@@ -244,3 +268,65 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     testRequest->StartAsync();
     EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
 }
+
+struct EmptyInferRequest : public InferRequestInternal {
+    EmptyInferRequest() : InferRequestInternal({}, {}) {}
+    void InferImpl() override {}
+    std::map<std::string, InferenceEngineProfileInfo> GetPerformanceCounts() const override {
+        return {};
+    }
+};
+
+TEST(InferRequestThreadSafeDefaultAllocationTests, startAsyncAndWaitDoNotAllocateAfterWarmUp) {
+    auto taskExecutor = std::make_shared<ImmediateExecutor>();
+    auto request = make_shared<AsyncInferRequestThreadSafeDefault>(std::make_shared<EmptyInferRequest>(), taskExecutor, taskExecutor);
+    request->StartAsync();
+    ASSERT_EQ(StatusCode::OK, request->Wait(IInferRequest::WaitMode::RESULT_READY));
+
+    allocationsCount = 0;
+    countAllocations = true;
+    for (int i = 0; i < 100; ++i) {
+        request->StartAsync();
+        request->Wait(IInferRequest::WaitMode::RESULT_READY);
+    }
+    countAllocations = false;
+    ASSERT_EQ(0u, allocationsCount.load());
+}
+
+// The first stage is passed to the executor and the start throws after that, so the pipeline is finished twice
+class ThrowingOnStartInferRequest : public AsyncInferRequestThreadSafeDefault {
+public:
+    using AsyncInferRequestThreadSafeDefault::AsyncInferRequestThreadSafeDefault;
+    ~ThrowingOnStartInferRequest() {
+        StopAndWait();
+    }
+
+protected:
+    void StartAsync_ThreadUnsafe() override {
+        AsyncInferRequestThreadSafeDefault::StartAsync_ThreadUnsafe();
+        THROW_IE_EXCEPTION << "start";
+    }
+};
+
+TEST(InferRequestThreadSafeDefaultPipelineTests, pipelineIsFinishedOnceIfStartThrowsAfterStageIsRun) {
+    auto taskExecutor = std::make_shared<ImmediateExecutor>();
+    auto request = make_shared<ThrowingOnStartInferRequest>(std::make_shared<EmptyInferRequest>(), taskExecutor, taskExecutor);
+    for (int i = 0; i < 2; ++i) {
+        ASSERT_THROW(request->StartAsync(), InferenceEngineException);
+        // the stages finished the pipeline first
+        ASSERT_EQ(StatusCode::OK, request->Wait(IInferRequest::WaitMode::RESULT_READY));
+    }
+    // waits for the running pipelines, so it hangs if the number of them is broken
+    request.reset();
+}
+
+TEST(InferRequestThreadSafeDefaultPipelineTests, pipelineIsFinishedOnceIfStartThrowsAfterStageIsEnqueued) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    auto request = make_shared<ThrowingOnStartInferRequest>(std::make_shared<EmptyInferRequest>(), taskExecutor, taskExecutor);
+    ASSERT_THROW(request->StartAsync(), InferenceEngineException);
+    // the failed start finished the pipeline first
+    ASSERT_THROW(request->Wait(IInferRequest::WaitMode::RESULT_READY), InferenceEngineException);
+    taskExecutor->executeAll();
+    ASSERT_THROW(request->Wait(IInferRequest::WaitMode::RESULT_READY), InferenceEngineException);
+    request.reset();
+}
@@ -0,0 +1,122 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset6.hpp>
+
+#include "ie_cache_manager.hpp"
+#include "compilation_context.hpp"
+#include "common_test_utils/file_utils.hpp"
+
+using namespace InferenceEngine;
+
+class FileStorageCacheManagerTests : public ::testing::Test {
+protected:
+    std::string cacheDir = "FileStorageCacheManagerTests_cache";
+    std::shared_ptr<ICacheManager> cacheManager;
+
+    void SetUp() override {
+        cacheManager = std::make_shared<FileStorageCacheManager>(cacheDir);
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeFilesWithExt(cacheDir, "tmp");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    std::string readEntry(const std::string& id) {
+        std::string content;
+        cacheManager->readCacheEntry(id, [&](std::istream& stream) {
+            std::getline(stream, content);
+        });
+        return content;
+    }
+};
+
+TEST_F(FileStorageCacheManagerTests, createsCacheDirectory) {
+    ASSERT_TRUE(CommonTestUtils::directoryExists(cacheDir));
+}
+
+TEST_F(FileStorageCacheManagerTests, canWriteAndReadEntry) {
+    cacheManager->writeCacheEntry("entry", [](std::ostream& stream) {
+        stream << "compiled network";
+    });
+    ASSERT_EQ("compiled network", readEntry("entry"));
+}
+
+TEST_F(FileStorageCacheManagerTests, readerIsNotCalledForMissingEntry) {
+    bool called = false;
+    cacheManager->readCacheEntry("missing", [&](std::istream&) {
+        called = true;
+    });
+    ASSERT_FALSE(called);
+}
+
+TEST_F(FileStorageCacheManagerTests, canRemoveEntry) {
+    cacheManager->writeCacheEntry("entry", [](std::ostream& stream) {
+        stream << "compiled network";
+    });
+    cacheManager->removeCacheEntry("entry");
+    ASSERT_EQ("", readEntry("entry"));
+}
+
+TEST_F(FileStorageCacheManagerTests, failedWriterDoesNotPublishEntry) {
+    ASSERT_ANY_THROW(cacheManager->writeCacheEntry("entry", [](std::ostream& stream) {
+        stream << "partially written";
+        throw std::runtime_error("export failed");
+    }));
+    ASSERT_EQ("", readEntry("entry"));
+    ASSERT_EQ(0, CommonTestUtils::removeFilesWithExt(cacheDir, "tmp"));
+}
+
+class NetworkCompilationContextTests : public ::testing::Test {
+protected:
+    static CNNNetwork makeNetwork(float constValue) {
+        auto param = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 4, 4});
+        param->set_friendly_name("input");
+        auto constant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {constValue});
+        auto add = std::make_shared<ngraph::opset6::Add>(param, constant);
+        auto result = std::make_shared<ngraph::opset6::Result>(add);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result},
+                                                             ngraph::ParameterVector{param}));
+    }
+};
+
+TEST_F(NetworkCompilationContextTests, hashIsStableForSameNetwork) {
+    auto network1 = makeNetwork(1.f);
+    auto network2 = makeNetwork(1.f);
+    ASSERT_EQ(NetworkCompilationContext::computeHash(network1, {{"DEVICE_NAME", "CPU"}}),
+              NetworkCompilationContext::computeHash(network2, {{"DEVICE_NAME", "CPU"}}));
+}
+
+TEST_F(NetworkCompilationContextTests, hashDependsOnWeights) {
+    ASSERT_NE(NetworkCompilationContext::computeHash(makeNetwork(1.f), {}),
+              NetworkCompilationContext::computeHash(makeNetwork(2.f), {}));
+}
+
+TEST_F(NetworkCompilationContextTests, hashDependsOnConfig) {
+    auto network = makeNetwork(1.f);
+    ASSERT_NE(NetworkCompilationContext::computeHash(network, {{"DEVICE_NAME", "CPU"}}),
+              NetworkCompilationContext::computeHash(network, {{"DEVICE_NAME", "GNA"}}));
+}
+
+TEST_F(NetworkCompilationContextTests, hashSeparatesConfigKeysAndValues) {
+    auto network = makeNetwork(1.f);
+    ASSERT_NE(NetworkCompilationContext::computeHash(network, {{"AB", "C"}}),
+              NetworkCompilationContext::computeHash(network, {{"A", "BC"}}));
+}
+
+TEST_F(NetworkCompilationContextTests, hashDependsOnInputsInfo) {
+    auto network = makeNetwork(1.f);
+    auto hash = NetworkCompilationContext::computeHash(network, {});
+    network.getInputsInfo().begin()->second->setPrecision(Precision::U8);
+    ASSERT_NE(hash, NetworkCompilationContext::computeHash(network, {}));
+}
@@ -0,0 +1,59 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <ie_blob.h>
+#include "ie_mmap_allocator.hpp"
+
+using namespace InferenceEngine;
+
+class MmapAllocatorTests : public ::testing::Test {
+protected:
+    std::string fileName = "MmapAllocatorTests.bin";
+    std::string content = "mapped weights content";
+
+    void SetUp() override {
+        std::ofstream file(fileName, std::ios::binary);
+        file << content;
+    }
+
+    void TearDown() override {
+        std::remove(fileName.c_str());
+    }
+};
+
+TEST_F(MmapAllocatorTests, blobContainsFileContent) {
+    auto blob = make_shared_blob<uint8_t>({Precision::U8, {content.size()}, C}, std::make_shared<MmapAllocator>(fileName));
+    blob->allocate();
+    ASSERT_NE(nullptr, blob->buffer().as<char*>());
+    ASSERT_EQ(content, std::string(blob->cbuffer().as<const char*>(), content.size()));
+}
+
+TEST_F(MmapAllocatorTests, writesToBlobDoNotChangeFile) {
+    {
+        auto blob = make_shared_blob<uint8_t>({Precision::U8, {content.size()}, C}, std::make_shared<MmapAllocator>(fileName));
+        blob->allocate();
+        blob->buffer().as<char*>()[0] = 'M';
+    }
+    std::ifstream file(fileName, std::ios::binary);
+    std::string fileContent;
+    std::getline(file, fileContent);
+    ASSERT_EQ(content, fileContent);
+}
+
+TEST_F(MmapAllocatorTests, cannotMapMoreThanFileSize) {
+    MmapAllocator allocator(fileName);
+    ASSERT_EQ(nullptr, allocator.alloc(content.size() + 1));
+}
+
+TEST_F(MmapAllocatorTests, cannotMapMissingFile) {
+    MmapAllocator allocator("MmapAllocatorTests_missing.bin");
+    ASSERT_EQ(nullptr, allocator.alloc(1));
+}
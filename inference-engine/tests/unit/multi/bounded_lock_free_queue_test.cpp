@@ -0,0 +1,111 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "multi_device_exec_network.hpp"
+
+using namespace MultiDevicePlugin;
+
+TEST(BoundedLockFreeQueueTests, rejectsOperationsBeforeCapacityIsSet) {
+    BoundedLockFreeQueue<int> queue;
+    int value = 0;
+    ASSERT_FALSE(queue.try_push(1));
+    ASSERT_FALSE(queue.try_pop(value));
+}
+
+TEST(BoundedLockFreeQueueTests, popsValuesInPushOrder) {
+    BoundedLockFreeQueue<int> queue;
+    queue.set_capacity(4);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.try_push(i));
+    }
+    ASSERT_EQ(4u, queue.unsafe_size());
+    for (int i = 0; i < 4; ++i) {
+        int value = -1;
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(i, value);
+    }
+    int value = -1;
+    ASSERT_FALSE(queue.try_pop(value));
+    ASSERT_EQ(0u, queue.unsafe_size());
+}
+
+TEST(BoundedLockFreeQueueTests, roundsCapacityUpToPowerOfTwo) {
+    BoundedLockFreeQueue<int> queue;
+    queue.set_capacity(3);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.try_push(i));
+    }
+    ASSERT_FALSE(queue.try_push(4));
+}
+
+TEST(BoundedLockFreeQueueTests, reusesCellsOnNextLaps) {
+    BoundedLockFreeQueue<int> queue;
+    queue.set_capacity(2);
+    for (int i = 0; i < 10; ++i) {
+        int value = -1;
+        ASSERT_TRUE(queue.try_push(i));
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(i, value);
+    }
+}
+
+TEST(BoundedLockFreeQueueTests, zeroCapacityClosesQueue) {
+    BoundedLockFreeQueue<int> queue;
+    queue.set_capacity(2);
+    ASSERT_TRUE(queue.try_push(1));
+    queue.set_capacity(0);
+    int value = 0;
+    ASSERT_FALSE(queue.try_push(2));
+    ASSERT_FALSE(queue.try_pop(value));
+}
+
+TEST(BoundedLockFreeQueueTests, concurrentProducersAndConsumersPassEveryValueOnce) {
+    constexpr int numThreads = 4;
+    constexpr int valuesPerProducer = 20000;
+    BoundedLockFreeQueue<int> queue;
+    queue.set_capacity(64);
+
+    std::vector<std::atomic<int>> seen(numThreads * valuesPerProducer);
+    for (auto&& counter : seen) {
+        counter = 0;
+    }
+    std::atomic<int> consumed = {0};
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < numThreads; ++producer) {
+        threads.emplace_back([&, producer] {
+            for (int i = 0; i < valuesPerProducer; ++i) {
+                while (!queue.try_push(producer * valuesPerProducer + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int consumer = 0; consumer < numThreads; ++consumer) {
+        threads.emplace_back([&] {
+            while (consumed < numThreads * valuesPerProducer) {
+                int value = -1;
+                if (queue.try_pop(value)) {
+                    seen[value]++;
+                    consumed++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+
+    for (std::size_t i = 0; i < seen.size(); ++i) {
+        ASSERT_EQ(1, seen[i].load()) << "value " << i;
+    }
+    ASSERT_EQ(0u, queue.unsafe_size());
+}
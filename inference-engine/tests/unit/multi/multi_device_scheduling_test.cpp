@@ -0,0 +1,180 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <ie_metric_helpers.hpp>
+#include <multi-device/multi_device_config.hpp>
+#include <cpp_interfaces/base/ie_executable_network_base.hpp>
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
+
+#include "multi_device_exec_network.hpp"
+
+using namespace InferenceEngine;
+using namespace MultiDevicePlugin;
+
+namespace {
+
+class FakeInferRequest : public InferRequestInternal {
+public:
+    FakeInferRequest(const InputsDataMap& networkInputs, const OutputsDataMap& networkOutputs,
+                     std::chrono::milliseconds latency) :
+        InferRequestInternal(networkInputs, networkOutputs), _latency{latency} {}
+
+    void InferImpl() override {
+        std::this_thread::sleep_for(_latency);
+    }
+
+    std::map<std::string, InferenceEngineProfileInfo> GetPerformanceCounts() const override {
+        return {};
+    }
+
+private:
+    std::chrono::milliseconds _latency;
+};
+
+// the network of a device which runs its requests in parallel, each inference takes the given time
+class FakeExecutableNetwork : public ExecutableNetworkThreadSafeDefault {
+public:
+    FakeExecutableNetwork(unsigned int numRequests, std::chrono::milliseconds latency) :
+        ExecutableNetworkThreadSafeDefault(std::make_shared<CPUStreamsExecutor>(
+            IStreamsExecutor::Config{"FakeDeviceExecutor", static_cast<int>(numRequests)})),
+        _numRequests{numRequests},
+        _latency{latency} {}
+
+    InferRequestInternal::Ptr CreateInferRequestImpl(InputsDataMap networkInputs, OutputsDataMap networkOutputs) override {
+        return std::make_shared<FakeInferRequest>(networkInputs, networkOutputs, _latency);
+    }
+
+    Parameter GetMetric(const std::string& name) const override {
+        if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+            IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, _numRequests);
+        }
+        THROW_IE_EXCEPTION << "Unsupported metric key " << name;
+    }
+
+private:
+    unsigned int                _numRequests;
+    std::chrono::milliseconds   _latency;
+};
+
+struct FakeDevice {
+    std::string                 name;
+    unsigned int                numRequests;
+    std::chrono::milliseconds   latency;
+};
+
+}  // namespace
+
+class MultiDeviceSchedulingTests : public ::testing::Test {
+protected:
+    static MultiDeviceExecutableNetwork::Ptr makeMultiNetwork(const std::vector<FakeDevice>& devices,
+                                                              const std::unordered_map<std::string, Parameter>& config = {}) {
+        DeviceMap<ExecutableNetwork> networks;
+        std::vector<DeviceInformation> priorities;
+        for (auto&& device : devices) {
+            networks[device.name] = make_executable_network(std::make_shared<FakeExecutableNetwork>(device.numRequests, device.latency));
+            priorities.push_back({device.name, {}, -1});
+        }
+        return std::make_shared<MultiDeviceExecutableNetwork>(networks, priorities, config);
+    }
+
+    // starts all the requests at once, so most of them are queued to the devices
+    static void inferAll(const MultiDeviceExecutableNetwork::Ptr& network, std::size_t numRequests) {
+        std::vector<InferRequest> requests;
+        for (std::size_t i = 0; i < numRequests; ++i) {
+            requests.emplace_back(network->CreateInferRequest());
+        }
+        for (auto&& request : requests) {
+            request.StartAsync();
+        }
+        for (auto&& request : requests) {
+            ASSERT_EQ(StatusCode::OK, request.Wait(IInferRequest::WaitMode::RESULT_READY));
+        }
+    }
+
+    // runs one request at a time, so every request may go to any device
+    static void inferOneByOne(const MultiDeviceExecutableNetwork::Ptr& network, std::size_t numRequests) {
+        InferRequest request(network->CreateInferRequest());
+        for (std::size_t i = 0; i < numRequests; ++i) {
+            request.Infer();
+        }
+    }
+
+    template <typename T>
+    static std::map<std::string, T> getDeviceMetric(const MultiDeviceExecutableNetwork::Ptr& network, const std::string& name) {
+        return network->GetMetric(name).as<std::map<std::string, T>>();
+    }
+};
+
+TEST_F(MultiDeviceSchedulingTests, metricsCountCompletedRequestsAndLatency) {
+    auto network = makeMultiNetwork({{"FAST", 2, std::chrono::milliseconds{1}}});
+    inferAll(network, 20);
+
+    auto completed = getDeviceMetric<uint64_t>(network, METRIC_KEY(MULTI_COMPLETED_INFER_REQUESTS));
+    ASSERT_EQ(20u, completed.at("FAST"));
+    auto stolen = getDeviceMetric<uint64_t>(network, METRIC_KEY(MULTI_STOLEN_INFER_REQUESTS));
+    ASSERT_EQ(0u, stolen.at("FAST"));
+    auto latency = getDeviceMetric<float>(network, METRIC_KEY(MULTI_AVERAGE_LATENCY));
+    ASSERT_GE(latency.at("FAST"), 1.f);
+}
+
+TEST_F(MultiDeviceSchedulingTests, idleDeviceStealsRequestsQueuedToBusyDevice) {
+    auto network = makeMultiNetwork({{"SLOW", 1, std::chrono::milliseconds{50}},
+                                     {"FAST", 2, std::chrono::milliseconds{1}}});
+    inferAll(network, 24);
+
+    auto completed = getDeviceMetric<uint64_t>(network, METRIC_KEY(MULTI_COMPLETED_INFER_REQUESTS));
+    ASSERT_EQ(24u, completed.at("SLOW") + completed.at("FAST"));
+    auto stolen = getDeviceMetric<uint64_t>(network, METRIC_KEY(MULTI_STOLEN_INFER_REQUESTS));
+    ASSERT_GT(stolen.at("FAST"), 0u);
+    ASSERT_GT(completed.at("FAST"), completed.at("SLOW"));
+}
+
+TEST_F(MultiDeviceSchedulingTests, pendingCountersReturnToZero) {
+    auto network = makeMultiNetwork({{"SLOW", 1, std::chrono::milliseconds{5}},
+                                     {"FAST", 2, std::chrono::milliseconds{1}}});
+    for (int i = 0; i < 10; ++i) {
+        inferAll(network, 16);
+    }
+    // the counters are unsigned, an underflow would leave them huge
+    for (auto&& statistics : network->_deviceStatistics) {
+        ASSERT_EQ(0u, statistics.second->_numPendingTasks.load()) << statistics.first;
+        ASSERT_EQ(0u, statistics.second->_numPendingDeviceSpecificTasks.load()) << statistics.first;
+    }
+}
+
+TEST_F(MultiDeviceSchedulingTests, expectedFinishTimeSendsRequestsToFasterDevice) {
+    auto network = makeMultiNetwork({{"SLOW", 1, std::chrono::milliseconds{10}},
+                                     {"FAST", 1, std::chrono::milliseconds{1}}},
+                                    {{MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+                                      std::string{MultiDeviceConfigParams::MULTI_EXPECTED_FINISH_TIME}}});
+    inferOneByOne(network, 10);
+
+    // only the first request goes to the slow device, while its latency is not measured yet
+    auto completed = getDeviceMetric<uint64_t>(network, METRIC_KEY(MULTI_COMPLETED_INFER_REQUESTS));
+    ASSERT_EQ(1u, completed.at("SLOW"));
+    ASSERT_EQ(9u, completed.at("FAST"));
+}
+
+TEST_F(MultiDeviceSchedulingTests, schedulingPolicyIsSupportedConfigKey) {
+    auto network = makeMultiNetwork({{"FAST", 1, std::chrono::milliseconds{1}}},
+                                    {{MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+                                      std::string{MultiDeviceConfigParams::MULTI_EXPECTED_FINISH_TIME}}});
+    std::vector<std::string> configKeys = network->GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    ASSERT_NE(configKeys.end(), std::find(configKeys.begin(), configKeys.end(),
+                                          MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY));
+    ASSERT_EQ(MultiDeviceConfigParams::MULTI_EXPECTED_FINISH_TIME,
+              network->GetConfig(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY).as<std::string>());
+}
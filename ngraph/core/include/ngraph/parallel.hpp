@@ -0,0 +1,43 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include <ngraph/ngraph_visibility.hpp>
+
+namespace ngraph
+{
+    /// \brief Calls its second argument for every index in [0, count), possibly concurrently.
+    using parallel_for_backend =
+        std::function<void(std::size_t count, const std::function<void(std::size_t)>& func)>;
+
+    /// \brief Sets the backend used by parallel_for. Inference Engine sets the one built on
+    ///        its threading backend, so the work runs in the current TBB arena or OpenMP
+    ///        team and is limited by the number of threads configured there.
+    /// \param backend The backend, an empty one makes parallel_for sequential.
+    NGRAPH_API
+    void set_parallel_for_backend(parallel_for_backend backend);
+
+    /// \brief Calls func for every index in [0, count) using the backend set by
+    ///        set_parallel_for_backend, or on the calling thread when there is no backend.
+    ///        func must not throw.
+    NGRAPH_API
+    void parallel_for(std::size_t count, const std::function<void(std::size_t)>& func);
+}
@@ -16,6 +16,11 @@
 
 #pragma once
 
+#include <chrono>
+#include <map>
+#include <string>
+#include <unordered_set>
+
 #include "ngraph/pass/pass.hpp"
 
 namespace ngraph
@@ -26,19 +31,52 @@ namespace ngraph
          * @brief Constant folding iterates over the function and tries to evaluate nodes
          *        with constant inputs. Such nodes are then replaced with new Constants containing
          *        the result of a folded operation.
+         *
+         *        Nodes whose inputs are all constants do not depend on each other, so they are
+         *        evaluated concurrently in waves: folding a wave turns its consumers into the
+         *        next wave. Time spent on folding is collected per operation type and logged
+         *        with NGRAPH_DEBUG after every run.
          */
         class NGRAPH_API ConstantFolding : public FunctionPass
         {
         public:
+            /// \brief Folding attempts and time accumulated for one operation type.
+            struct OpStatistics
+            {
+                size_t attempts = 0;
+                size_t folded = 0;
+                std::chrono::nanoseconds time{0};
+            };
+
             NGRAPH_RTTI_DECLARATION;
             bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
+            /// \brief Returns statistics accumulated by all runs of this pass keyed by the
+            /// operation type name.
+            const std::map<std::string, OpStatistics>& get_statistics() const
+            {
+                return m_statistics;
+            }
+
         private:
+            bool fold_function(const std::shared_ptr<ngraph::Function>& f);
+            /// \brief Folds nodes whose inputs are all constants in parallel, wave by wave.
+            /// Nodes that were tried are added to visited.
+            bool fold_constant_waves(const std::shared_ptr<ngraph::Function>& f,
+                                     bool revalidate,
+                                     std::unordered_set<Node*>& visited);
+            bool replace_outputs(const std::shared_ptr<Node>& node,
+                                 const OutputVector& replacements);
+            void record(const std::shared_ptr<Node>& node,
+                        bool folded,
+                        std::chrono::nanoseconds time);
             void copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node,
                                                     const Output<Node>& replacement);
             /// \brief Folds pre-calculated output tensor values to constants in case lower and
             /// upper estimations are equal. Traverses graph backwards starting from the results.
             bool pre_calculated_values_folding(const std::shared_ptr<ngraph::Function>& f);
+
+            std::map<std::string, OpStatistics> m_statistics;
         };
     } // namespace pass
 } // namespace ngraph
@@ -40,6 +40,12 @@ namespace ngraph
             void convert<uint8_t, float16>(const uint8_t* arg, float16* out, size_t count);
             template <>
             void convert<float16, float>(const float16* arg, float* out, size_t count);
+            template <>
+            void convert<float, float16>(const float* arg, float16* out, size_t count);
+            template <>
+            void convert<uint8_t, float>(const uint8_t* arg, float* out, size_t count);
+            template <>
+            void convert<int8_t, float>(const int8_t* arg, float* out, size_t count);
 
             template <typename TI, typename TO>
             typename std::enable_if<std::is_same<TO, char>::value>::type
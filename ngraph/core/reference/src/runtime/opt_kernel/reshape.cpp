@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <cmath>
+#include <cstring>
 #include <stdio.h>
 
 #include "ngraph/check.hpp"
@@ -24,228 +25,92 @@ using namespace ngraph;
 
 namespace
 {
-    void reshape_in0(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
+    template <size_t elem_size>
+    void copy_strided(const char* in, char* out, size_t count, size_t stride)
     {
-        memcpy(out, in, elem_size);
-    }
-
-    void reshape_in1(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[1];
-        size_t in_index[1];
-        size_t* map_index[1];
-        for (size_t i = 0; i < 1; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        for (size_t i = 0; i < count; ++i)
         {
-            memcpy(out, in + *map_index[0] * elem_size, elem_size);
-            out += elem_size;
+            memcpy(out + i * elem_size, in + i * stride, elem_size);
         }
     }
 
-    void reshape_in2(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
+    // Copies the input with permuted axes walking the output in row-major order. The innermost
+    // input axes keeping their order are merged into a block copied by a single memcpy, other
+    // elements of known size are copied without a call.
+    void permute_blocks(const char* in,
+                        char* out,
+                        const Shape& in_shape,
+                        const AxisVector& in_axis_order,
+                        size_t elem_size)
     {
-        size_t size[2];
-        size_t in_index[2];
-        size_t* map_index[2];
-        for (size_t i = 0; i < 2; i++)
+        size_t rank = in_shape.size();
+        size_t block = elem_size;
+        while (rank > 0 && in_axis_order[rank - 1] == rank - 1)
         {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
+            block *= in_shape[rank - 1];
+            --rank;
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        if (rank == 0)
         {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-            {
-                // clang-format off
-                memcpy(out,
-                       in + (*map_index[0] * in_shape[1] +
-                             *map_index[1]) * elem_size,
-                       elem_size);
-                out += elem_size;
-                // clang-format on
-            }
+            memcpy(out, in, block);
+            return;
         }
-    }
 
-    void reshape_in3(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[3];
-        size_t in_index[3];
-        size_t* map_index[3];
-        for (size_t i = 0; i < 3; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        std::vector<size_t> in_strides(in_shape.size());
+        size_t stride = elem_size;
+        for (size_t i = in_shape.size(); i-- > 0;)
         {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-            {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                {
-                    // clang-format off
-                    memcpy(out,
-                           in + (*map_index[0] * in_shape[1] * in_shape[2] +
-                                 *map_index[1] * in_shape[2] +
-                                 *map_index[2]) * elem_size,
-                           elem_size);
-                    out += elem_size;
-                    // clang-format on
-                }
-            }
+            in_strides[i] = stride;
+            stride *= in_shape[i];
         }
-    }
 
-    void reshape_in4(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[4];
-        size_t in_index[4];
-        size_t* map_index[4];
-        for (size_t i = 0; i < 4; i++)
+        std::vector<size_t> dims(rank);
+        std::vector<size_t> strides(rank);
+        for (size_t i = 0; i < rank; ++i)
         {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
+            dims[i] = in_shape[in_axis_order[i]];
+            strides[i] = in_strides[in_axis_order[i]];
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        const size_t inner = dims[rank - 1];
+        const size_t inner_stride = strides[rank - 1];
+        size_t outer = 1;
+        for (size_t i = 0; i + 1 < rank; ++i)
         {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-            {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                {
-                    for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
-                    {
-                        // clang-format off
-                        memcpy(out,
-                               in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] +
-                                     *map_index[1] * in_shape[2] * in_shape[3] +
-                                     *map_index[2] * in_shape[3] +
-                                     *map_index[3]) * elem_size,
-                               elem_size);
-                        out += elem_size;
-                        // clang-format on
-                    }
-                }
-            }
+            outer *= dims[i];
         }
-    }
 
-    void reshape_in5(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[5];
-        size_t in_index[5];
-        size_t* map_index[5];
-        for (size_t i = 0; i < 5; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        std::vector<size_t> counters(rank, 0);
+        for (size_t k = 0; k < outer; ++k)
         {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+            switch (block)
             {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
+            case 1: copy_strided<1>(in, out, inner, inner_stride); break;
+            case 2: copy_strided<2>(in, out, inner, inner_stride); break;
+            case 4: copy_strided<4>(in, out, inner, inner_stride); break;
+            case 8: copy_strided<8>(in, out, inner, inner_stride); break;
+            default:
+                for (size_t i = 0; i < inner; ++i)
                 {
-                    for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
-                    {
-                        for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4])
-                        {
-                            // clang-format off
-                            memcpy(out,
-                                   in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[3] * in_shape[4] +
-                                         *map_index[4]) * elem_size,
-                                   elem_size);
-                            out += elem_size;
-                            // clang-format on
-                        }
-                    }
+                    memcpy(out + i * block, in + i * inner_stride, block);
                 }
+                break;
             }
-        }
-    }
+            out += inner * block;
 
-    void reshape_in6(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[6];
-        size_t in_index[6];
-        size_t* map_index[6];
-        for (size_t i = 0; i < 6; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-        {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+            for (size_t i = rank - 1; i-- > 0;)
             {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
+                in += strides[i];
+                if (++counters[i] < dims[i])
                 {
-                    for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
-                    {
-                        for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4])
-                        {
-                            for (in_index[5] = 0; in_index[5] < size[5]; ++in_index[5])
-                            {
-                                // clang-format off
-                                memcpy(out,
-                                       in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[4] * in_shape[5] +
-                                             *map_index[5]) * elem_size,
-                                       elem_size);
-                                out += elem_size;
-                                // clang-format on
-                            }
-                        }
-                    }
+                    break;
                 }
+                in -= strides[i] * dims[i];
+                counters[i] = 0;
             }
         }
     }
 }
+
 void runtime::opt_kernel::reshape(const char* in,
                                   char* out,
                                   const Shape& in_shape,
@@ -253,15 +118,9 @@ void runtime::opt_kernel::reshape(const char* in,
                                   const Shape& out_shape,
                                   size_t elem_size)
 {
-    switch (in_shape.size())
+    if (shape_size(in_shape) == 0)
     {
-    case 0: reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 1: reshape_in1(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 2: reshape_in2(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 3: reshape_in3(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 4: reshape_in4(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 5: reshape_in5(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 6: reshape_in6(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    default: reference::reshape(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
+        return;
     }
+    permute_blocks(in, out, in_shape, in_axis_order, elem_size);
 }
@@ -58,6 +58,49 @@ namespace ngraph
                     gen.vmovups(gen.yword[dst], f32vec);
                 }
 
+                template <>
+                void jit_convert_vec<float, float16>(jit::Generator& gen,
+                                                     const Xbyak::RegExp& src,
+                                                     const Xbyak::RegExp& dst)
+                {
+                    auto f16vec = gen.xmm3;
+                    auto f32vec = gen.ymm4;
+
+                    gen.vmovups(f32vec, gen.yword[src]);
+                    gen.vcvtps2ph(f16vec, f32vec, 0);
+                    gen.movdqu(gen.xword[dst], f16vec);
+                }
+
+                template <>
+                void jit_convert_vec<uint8_t, float>(jit::Generator& gen,
+                                                     const Xbyak::RegExp& src,
+                                                     const Xbyak::RegExp& dst)
+                {
+                    auto u8vec = gen.xmm1;
+                    auto i32vec = gen.ymm2;
+                    auto fvec = gen.ymm4;
+
+                    gen.movq(u8vec, gen.qword[src]);
+                    gen.vpmovzxbd(i32vec, u8vec);
+                    gen.vcvtdq2ps(fvec, i32vec);
+                    gen.vmovups(gen.yword[dst], fvec);
+                }
+
+                template <>
+                void jit_convert_vec<int8_t, float>(jit::Generator& gen,
+                                                    const Xbyak::RegExp& src,
+                                                    const Xbyak::RegExp& dst)
+                {
+                    auto i8vec = gen.xmm1;
+                    auto i32vec = gen.ymm2;
+                    auto fvec = gen.ymm4;
+
+                    gen.movq(i8vec, gen.qword[src]);
+                    gen.vpmovsxbd(i32vec, i8vec);
+                    gen.vcvtdq2ps(fvec, i32vec);
+                    gen.vmovups(gen.yword[dst], fvec);
+                }
+
                 class jit_convert_array : public jit::Generator
                 {
                     typedef struct context
@@ -159,42 +202,56 @@ namespace ngraph
                 };
             } // namespace
 
-            template <>
-            void convert<uint8_t, float16>(const uint8_t* arg, float16* out, size_t count)
+            namespace
             {
-                auto converter = jit_convert_array::get<uint8_t, float16>();
-
-                if (converter)
-                {
-                    jit_convert_array::args_t args = {arg, out, count};
-                    converter(&args);
-                }
-                else
+                template <typename src_t, typename dst_t>
+                void jit_convert(const src_t* arg, dst_t* out, size_t count)
                 {
-                    for (size_t i = 0; i < count; ++i)
+                    auto converter = jit_convert_array::get<src_t, dst_t>();
+
+                    if (converter)
+                    {
+                        jit_convert_array::args_t args = {arg, out, count};
+                        converter(&args);
+                    }
+                    else
                     {
-                        out[i] = static_cast<float16>(arg[i]);
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            out[i] = static_cast<dst_t>(arg[i]);
+                        }
                     }
                 }
+            } // namespace
+
+            template <>
+            void convert<uint8_t, float16>(const uint8_t* arg, float16* out, size_t count)
+            {
+                jit_convert(arg, out, count);
             }
 
             template <>
             void convert<float16, float>(const float16* arg, float* out, size_t count)
             {
-                auto converter = jit_convert_array::get<float16, float>();
+                jit_convert(arg, out, count);
+            }
+
+            template <>
+            void convert<float, float16>(const float* arg, float16* out, size_t count)
+            {
+                jit_convert(arg, out, count);
+            }
 
-                if (converter)
-                {
-                    jit_convert_array::args_t args = {arg, out, count};
-                    converter(&args);
-                }
-                else
-                {
-                    for (size_t i = 0; i < count; ++i)
-                    {
-                        out[i] = static_cast<float>(arg[i]);
-                    }
-                }
+            template <>
+            void convert<uint8_t, float>(const uint8_t* arg, float* out, size_t count)
+            {
+                jit_convert(arg, out, count);
+            }
+
+            template <>
+            void convert<int8_t, float>(const int8_t* arg, float* out, size_t count)
+            {
+                jit_convert(arg, out, count);
             }
         }
     }
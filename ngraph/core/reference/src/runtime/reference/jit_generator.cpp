@@ -169,6 +169,14 @@ namespace ngraph
                 pop(rsi);
             }
 
+            template <>
+            void Generator::copy<int8_t>(const Xbyak::Reg64& dst,
+                                         const Xbyak::Reg64& src,
+                                         const Xbyak::Reg64& size)
+            {
+                copy<uint8_t>(dst, src, size);
+            }
+
             template <>
             void Generator::copy<uint16_t>(const Xbyak::Reg64& dst,
                                            const Xbyak::Reg64& src,
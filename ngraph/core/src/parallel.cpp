@@ -0,0 +1,62 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <mutex>
+
+#include "ngraph/parallel.hpp"
+
+using namespace std;
+
+namespace
+{
+    mutex& backend_mutex()
+    {
+        static mutex m;
+        return m;
+    }
+
+    ngraph::parallel_for_backend& backend()
+    {
+        static ngraph::parallel_for_backend b;
+        return b;
+    }
+}
+
+void ngraph::set_parallel_for_backend(parallel_for_backend b)
+{
+    lock_guard<mutex> lock(backend_mutex());
+    backend() = move(b);
+}
+
+void ngraph::parallel_for(size_t count, const function<void(size_t)>& func)
+{
+    parallel_for_backend b;
+    if (count > 1)
+    {
+        lock_guard<mutex> lock(backend_mutex());
+        b = backend();
+    }
+    if (b)
+    {
+        b(count, func);
+        return;
+    }
+    for (size_t i = 0; i < count; ++i)
+    {
+        func(i);
+    }
+}
@@ -15,8 +15,18 @@
 //*****************************************************************************
 
 #include "ngraph/pass/constant_folding.hpp"
+#include <algorithm>
+#include <exception>
 #include <ngraph/op/constant.hpp>
+#include <vector>
+#include "ngraph/log.hpp"
+#include "ngraph/op/convert_like.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/shape_of.hpp"
+#include "ngraph/op/sink.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "ngraph/parallel.hpp"
 #include "ngraph/rt_info.hpp"
 
 using namespace std;
@@ -24,10 +34,71 @@ using namespace ngraph;
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConstantFolding, "ConstantFolding", 0);
 
+namespace
+{
+    bool has_constant_inputs(const Node* node)
+    {
+        for (const auto& input : node->inputs())
+        {
+            if (!is_type<op::Constant>(input.get_source_output().get_node()))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// \brief Nodes which can be folded concurrently with other nodes. Folding of ConvertLike
+    /// builds a Convert on top of an input constant shared with other nodes, operations with
+    /// subgraphs and the rest are left for the sequential pass.
+    bool can_fold_concurrently(const Node* node)
+    {
+        return node->get_input_size() > 0 && !is_type<op::Constant>(node) &&
+               !is_type<op::Parameter>(node) && !is_type<op::Result>(node) &&
+               !is_type<op::v0::ShapeOf>(node) && !is_type<op::v3::ShapeOf>(node) &&
+               !is_type<op::v1::ConvertLike>(node) &&
+               !dynamic_cast<const op::Sink*>(node) &&
+               !dynamic_cast<const op::util::SubGraphOp*>(node) && has_constant_inputs(node);
+    }
+}
+
 bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Function> f)
+{
+#ifdef NGRAPH_DEBUG_ENABLE
+    auto statistics = m_statistics;
+#endif
+    bool rewritten = fold_function(f);
+
+#ifdef NGRAPH_DEBUG_ENABLE
+    for (const auto& op_statistics : m_statistics)
+    {
+        const auto& previous = statistics[op_statistics.first];
+        const auto& current = op_statistics.second;
+        if (current.attempts == previous.attempts)
+        {
+            continue;
+        }
+        NGRAPH_DEBUG << "Constant folding of " << f->get_friendly_name() << ": "
+                     << op_statistics.first << " folded " << current.folded - previous.folded
+                     << " of " << current.attempts - previous.attempts << " in "
+                     << chrono::duration_cast<chrono::milliseconds>(current.time -
+                                                                    previous.time)
+                            .count()
+                     << "ms";
+    }
+#endif
+
+    return rewritten;
+}
+
+bool ngraph::pass::ConstantFolding::fold_function(const std::shared_ptr<ngraph::Function>& f)
 {
     bool rewritten = pre_calculated_values_folding(f);
 
+    // nodes already tried by the waves have constant inputs that did not change since
+    unordered_set<Node*> visited;
+    rewritten |= fold_constant_waves(f, rewritten, visited);
+
     for (const auto& node : f->get_ordered_ops())
     {
         if (rewritten)
@@ -35,36 +106,22 @@ bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Func
             node->validate_and_infer_types();
         }
 
-        OutputVector replacements(node->get_output_size());
-        if (node->constant_fold(replacements, node->input_values()))
+        if (visited.count(node.get()))
         {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
-
-            for (size_t i = 0; i < replacements.size(); ++i)
-            {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement))
-                {
-                    if (replacements.size() == 1)
-                    {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name());
-                    }
-                    else
-                    {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name() + "." + std::to_string(i));
-                    }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
+            continue;
+        }
 
-                    rewritten = true;
-                }
-            }
+        OutputVector replacements(node->get_output_size());
+        const auto fold_start = chrono::steady_clock::now();
+        const bool folded = node->constant_fold(replacements, node->input_values());
+        if (!is_type<op::Constant>(node) && !is_type<op::Parameter>(node) &&
+            !is_type<op::Result>(node))
+        {
+            record(node, folded, chrono::steady_clock::now() - fold_start);
+        }
+        if (folded)
+        {
+            rewritten |= replace_outputs(node, replacements);
         }
         else
         {
@@ -73,15 +130,139 @@ bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Func
             {
                 if (const auto& sub_graph = sub_graph_node->get_function())
                 {
-                    rewritten |= run_on_function(sub_graph);
+                    rewritten |= fold_function(sub_graph);
+                }
+            }
+        }
+    }
+
+    return rewritten;
+}
+
+bool ngraph::pass::ConstantFolding::fold_constant_waves(const std::shared_ptr<ngraph::Function>& f,
+                                                        bool revalidate,
+                                                        std::unordered_set<Node*>& visited)
+{
+    vector<shared_ptr<Node>> wave;
+    for (const auto& node : f->get_ordered_ops())
+    {
+        if (can_fold_concurrently(node.get()))
+        {
+            wave.push_back(node);
+            visited.insert(node.get());
+        }
+    }
+
+    bool rewritten = false;
+    while (!wave.empty())
+    {
+        if (revalidate || rewritten)
+        {
+            for (const auto& node : wave)
+            {
+                node->validate_and_infer_types();
+            }
+        }
+
+        vector<OutputVector> replacements(wave.size());
+        vector<char> folded(wave.size(), 0);
+        vector<chrono::nanoseconds> times(wave.size());
+        vector<exception_ptr> errors(wave.size());
+        ngraph::parallel_for(wave.size(), [&](size_t i) {
+            const auto& node = wave[i];
+            const auto fold_start = chrono::steady_clock::now();
+            try
+            {
+                replacements[i].resize(node->get_output_size());
+                folded[i] = node->constant_fold(replacements[i], node->input_values());
+            }
+            catch (...)
+            {
+                errors[i] = current_exception();
+            }
+            times[i] = chrono::steady_clock::now() - fold_start;
+        });
+
+        vector<shared_ptr<Node>> next_wave;
+        for (size_t i = 0; i < wave.size(); ++i)
+        {
+            const auto& node = wave[i];
+            if (errors[i])
+            {
+                rethrow_exception(errors[i]);
+            }
+            record(node, folded[i], times[i]);
+            if (!folded[i] || !replace_outputs(node, replacements[i]))
+            {
+                continue;
+            }
+            rewritten = true;
+            for (const auto& replacement : replacements[i])
+            {
+                if (!replacement.get_node())
+                {
+                    continue;
+                }
+                for (const auto& input : replacement.get_target_inputs())
+                {
+                    auto consumer = input.get_node();
+                    if (!visited.count(consumer) && can_fold_concurrently(consumer))
+                    {
+                        next_wave.push_back(consumer->shared_from_this());
+                        visited.insert(consumer);
+                    }
                 }
             }
         }
+        wave.swap(next_wave);
     }
 
     return rewritten;
 }
 
+bool ngraph::pass::ConstantFolding::replace_outputs(const std::shared_ptr<Node>& node,
+                                                    const OutputVector& replacements)
+{
+    NGRAPH_CHECK(replacements.size() == node->get_output_size(),
+                 "constant_fold_default returned incorrect number of replacements for ",
+                 node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i)
+    {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement))
+        {
+            if (replacements.size() == 1)
+            {
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
+            }
+            else
+            {
+                replacement.get_node_shared_ptr()->set_friendly_name(
+                    node->get_friendly_name() + "." + std::to_string(i));
+            }
+            node_output.replace(replacement);
+            // Propagate runtime info attributes to replacement consumer nodes
+            copy_runtime_info_to_target_inputs(node, replacement);
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
+void ngraph::pass::ConstantFolding::record(const std::shared_ptr<Node>& node,
+                                           bool folded,
+                                           std::chrono::nanoseconds time)
+{
+    auto& op_statistics = m_statistics[node->get_type_info().name];
+    ++op_statistics.attempts;
+    op_statistics.folded += folded ? 1 : 0;
+    op_statistics.time += time;
+}
+
 void ngraph::pass::ConstantFolding::copy_runtime_info_to_target_inputs(
     const std::shared_ptr<Node>& node, const Output<Node>& replacement)
 {
@@ -95,6 +95,25 @@ namespace ngraph
         /// \return    An nGraph function representing the previously modified ONNX model.
         ONNX_IMPORTER_API
         std::shared_ptr<Function> import_onnx_model(const ONNXModelEditor& model_editor);
+
+        /// \brief     Enables or disables the process-wide cache of imported models.
+        ///
+        /// \note      The cache is keyed by a digest of the serialized model and its path,
+        ///            importing the same model again returns a clone of the cached function
+        ///            without parsing and converting the model. The constants of the clone
+        ///            share their data with the cached function.
+        ///            Models imported through the ONNXModelEditor are never cached. Changes of
+        ///            external data files are not tracked. Registering or unregistering an
+        ///            operator clears the cache. The cache is disabled by default unless the
+        ///            NGRAPH_ONNX_IMPORT_CACHE environment variable is set.
+        ///
+        /// \param[in] enabled  Whether imported models should be cached.
+        ONNX_IMPORTER_API
+        void set_import_cache_enabled(bool enabled);
+
+        /// \brief     Removes all models from the process-wide import cache.
+        ONNX_IMPORTER_API
+        void clear_import_cache();
     } // namespace onnx_import
 
 } // namespace ngraph
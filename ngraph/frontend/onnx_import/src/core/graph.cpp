@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <exception>
 #include <functional>
 #include <numeric>
@@ -24,6 +25,7 @@
 #include "exceptions.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/parallel.hpp"
 #include "ngraph/provenance.hpp"
 #include "onnx_import/core/node.hpp"
 #include "utils/common.hpp"
@@ -96,42 +98,68 @@ namespace ngraph
             , m_cache{std::move(cache)}
         {
             std::map<std::string, Tensor> initializers;
-            // Process all initializers in the graph
+            std::vector<const ONNX_NAMESPACE::TensorProto*> initializer_tensors;
             for (const auto& initializer_tensor : m_graph_proto->initializer())
             {
                 if (initializer_tensor.has_name())
                 {
-                    Tensor tensor = Tensor{initializer_tensor};
-                    std::shared_ptr<default_opset::Constant> ng_constant;
-                    // For each initializer create a Constant node and store it in cache
-                    try
-                    {
-                        ng_constant = tensor.get_ng_constant();
-                    }
-                    catch (const error::invalid_external_data&)
-                    {
-                        // invalid external data makes initializers creation impossible
-                        throw;
-                    }
-                    catch (const ngraph::ngraph_error& exc)
+                    initializer_tensors.push_back(&initializer_tensor);
+                }
+            }
+
+            // Decoding of initializers is independent, so the Constants are created
+            // concurrently and only stored in the cache in the original order
+            std::vector<std::shared_ptr<default_opset::Constant>> ng_constants(
+                initializer_tensors.size());
+            std::vector<std::exception_ptr> errors(initializer_tensors.size());
+            ngraph::parallel_for(initializer_tensors.size(), [&](std::size_t i) {
+                try
+                {
+                    ng_constants[i] = Tensor{*initializer_tensors[i]}.get_ng_constant();
+                }
+                catch (...)
+                {
+                    errors[i] = std::current_exception();
+                }
+            });
+
+            // Process all initializers in the graph
+            for (std::size_t i = 0; i < initializer_tensors.size(); ++i)
+            {
+                const auto& initializer_tensor = *initializer_tensors[i];
+                Tensor tensor = Tensor{initializer_tensor};
+                std::shared_ptr<default_opset::Constant> ng_constant = ng_constants[i];
+                // For each initializer create a Constant node and store it in cache
+                try
+                {
+                    if (errors[i])
                     {
-                        NGRAPH_WARN
-                            << "\nCould not create an nGraph Constant for initializer '"
-                            << initializer_tensor.name() << "'. \n"
-                            << "Constant with a 0 value was created, make sure connected input is "
-                               "optional.\n"
-                            << "Otherwise verify if the initializer contains a correct number of "
-                               "elements matching the initializer's shape. \n"
-                            << "Detailed error:\n"
-                            << exc.what();
-                        ng_constant =
-                            default_opset::Constant::create(tensor.get_ng_type(), Shape{}, {0});
+                        std::rethrow_exception(errors[i]);
                     }
-
-                    initializers.emplace(initializer_tensor.name(), tensor);
-                    add_provenance_tag_to_initializer(tensor, ng_constant);
-                    m_cache->emplace_node(initializer_tensor.name(), std::move(ng_constant));
                 }
+                catch (const error::invalid_external_data&)
+                {
+                    // invalid external data makes initializers creation impossible
+                    throw;
+                }
+                catch (const ngraph::ngraph_error& exc)
+                {
+                    NGRAPH_WARN
+                        << "\nCould not create an nGraph Constant for initializer '"
+                        << initializer_tensor.name() << "'. \n"
+                        << "Constant with a 0 value was created, make sure connected input is "
+                           "optional.\n"
+                        << "Otherwise verify if the initializer contains a correct number of "
+                           "elements matching the initializer's shape. \n"
+                        << "Detailed error:\n"
+                        << exc.what();
+                    ng_constant =
+                        default_opset::Constant::create(tensor.get_ng_type(), Shape{}, {0});
+                }
+
+                initializers.emplace(initializer_tensor.name(), tensor);
+                add_provenance_tag_to_initializer(tensor, ng_constant);
+                m_cache->emplace_node(initializer_tensor.name(), std::move(ng_constant));
             }
 
             // Process all ONNX graph inputs, convert them to nGraph nodes and store in cache
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstring>
 #include <onnx/onnx_pb.h>
 #include <utility>
 #include <vector>
@@ -146,9 +148,15 @@ namespace ngraph
                             get_external_data(const ONNX_NAMESPACE::TensorProto& tensor)
                         {
                             const auto tensor_external_data = TensorExternalData(tensor);
-                            const auto raw_data = tensor_external_data.load_external_data();
-
-                            return detail::__get_raw_data<T>(raw_data, tensor.data_type());
+                            const auto buffer = tensor_external_data.load_external_mmap_data();
+
+                            // mapped data isn't necessarily aligned for T, so it's copied bytewise
+                            std::vector<T> data(buffer->size() /
+                                                common::get_onnx_data_size(tensor.data_type()));
+                            std::memcpy(data.data(),
+                                        buffer->get_ptr(),
+                                        std::min(buffer->size(), data.size() * sizeof(T)));
+                            return data;
                         }
 
                         bool has_tensor_external_data(const ONNX_NAMESPACE::TensorProto& tensor)
@@ -580,8 +588,16 @@ namespace ngraph
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                std::shared_ptr<ngraph::op::Constant> constant;
+                if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto) &&
+                    !m_tensor_proto->has_segment())
+                {
+                    constant = make_ng_constant_from_mapping(type);
+                }
+                if (!constant)
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -589,6 +605,22 @@ namespace ngraph
                 return constant;
             }
 
+            /// \brief  Creates a constant referring to the mapped external data without a copy,
+            ///         returns nullptr if the data is misaligned or too short for the shape,
+            ///         so the regular path takes care of it.
+            std::shared_ptr<ngraph::op::Constant>
+                make_ng_constant_from_mapping(const element::Type& type) const
+            {
+                const auto buffer =
+                    detail::TensorExternalData(*m_tensor_proto).load_external_mmap_data();
+                const auto ptr = reinterpret_cast<std::uintptr_t>(buffer->get_ptr());
+                if (ptr % type.size() != 0 || buffer->size() < shape_size(m_shape) * type.size())
+                {
+                    return nullptr;
+                }
+                return std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+            }
+
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
             Shape m_shape;
         };
@@ -14,13 +14,23 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <fstream>
+#include <functional>
+#include <iterator>
+#include <list>
 #include <memory>
+#include <mutex>
+#include <string>
 
 #include "core/graph.hpp"
 #include "core/model.hpp"
 #include "core/transform.hpp"
+#include "ngraph/env_util.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/graph_util.hpp"
 #include "onnx_import/onnx.hpp"
 #include "ops_bridge.hpp"
 #include "utils/parser.hpp"
@@ -55,14 +65,172 @@ namespace ngraph
 
                 return detail::convert_to_ng_function(model_proto);
             }
+
+            /// \brief  Identifies an imported model by its path and a digest of its bytes.
+            struct CacheKey
+            {
+                std::string model_path;
+                std::size_t model_size;
+                // two independent 64-bit hashes, so different models of the same size and
+                // path practically never collide
+                std::uint64_t digest[2];
+
+                bool operator==(const CacheKey& other) const
+                {
+                    return model_size == other.model_size && digest[0] == other.digest[0] &&
+                           digest[1] == other.digest[1] && model_path == other.model_path;
+                }
+            };
+
+            CacheKey get_cache_key(const std::string& model, const std::string& model_path)
+            {
+                // FNV-1a
+                std::uint64_t fnv = 0xcbf29ce484222325ull;
+                for (const auto c : model)
+                {
+                    fnv = (fnv ^ static_cast<unsigned char>(c)) * 0x100000001b3ull;
+                }
+                return CacheKey{model_path,
+                                model.size(),
+                                {static_cast<std::uint64_t>(std::hash<std::string>{}(model)),
+                                 fnv}};
+            }
+
+            /// \brief  Keeps a few recently imported functions, clones of them are returned
+            ///         when a model with the same content is imported again.
+            class ImportCache
+            {
+            public:
+                static ImportCache& get()
+                {
+                    // never destroyed, may be used during static deinitialization
+                    static auto cache = new ImportCache;
+                    return *cache;
+                }
+
+                bool is_enabled() const { return m_enabled; }
+                void set_enabled(bool enabled) { m_enabled = enabled; }
+                /// \brief  The generation changes whenever the cache is cleared, a function
+                ///         imported in an older generation is not inserted any more.
+                std::size_t get_generation() const { return m_generation; }
+                std::shared_ptr<Function> find(const CacheKey& key)
+                {
+                    std::shared_ptr<Function> function;
+                    {
+                        std::lock_guard<std::mutex> lock{m_mutex};
+                        auto entry = std::find_if(m_lru.begin(),
+                                                  m_lru.end(),
+                                                  [&](const Entry& e) { return e.key == key; });
+                        if (entry == m_lru.end())
+                        {
+                            return nullptr;
+                        }
+                        m_lru.splice(m_lru.begin(), m_lru, entry);
+                        function = entry->function;
+                    }
+                    return clone(*function);
+                }
+
+                void insert(const CacheKey& key,
+                            const std::shared_ptr<Function>& function,
+                            std::size_t generation)
+                {
+                    // the cached copy must not be affected by changes of the returned function
+                    auto cached = clone(*function);
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    if (generation != m_generation ||
+                        std::any_of(m_lru.begin(), m_lru.end(), [&](const Entry& e) {
+                            return e.key == key;
+                        }))
+                    {
+                        return;
+                    }
+                    m_lru.push_front(Entry{key, std::move(cached)});
+                    if (m_lru.size() > capacity)
+                    {
+                        m_lru.pop_back();
+                    }
+                }
+
+                void clear()
+                {
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    m_lru.clear();
+                    ++m_generation;
+                }
+
+            private:
+                struct Entry
+                {
+                    CacheKey key;
+                    std::shared_ptr<Function> function;
+                };
+
+                static constexpr std::size_t capacity = 8;
+
+                ImportCache()
+                    : m_enabled{getenv_bool("NGRAPH_ONNX_IMPORT_CACHE")}
+                {
+                }
+
+                static std::shared_ptr<Function> clone(const Function& function)
+                {
+                    NodeMap node_map;
+                    // the clones of constants share their data with the cached function, the same
+                    // way the constants of external data share the mapped file
+                    auto cloned = clone_function(function, node_map);
+                    // clone_function doesn't carry tensor names which are set by the importer
+                    for (const auto& item : node_map)
+                    {
+                        for (std::size_t i = 0; i < item.first->get_output_size(); ++i)
+                        {
+                            item.second->get_output_tensor(i).set_names(
+                                item.first->get_output_tensor(i).get_names());
+                        }
+                    }
+                    return cloned;
+                }
+
+                std::atomic<bool> m_enabled;
+                std::atomic<std::size_t> m_generation{0};
+                std::mutex m_mutex;
+                // a handful of entries, a linear search is cheaper than keeping an index
+                std::list<Entry> m_lru;
+            };
+
+            constexpr std::size_t ImportCache::capacity;
         } // namespace detail
 
         std::shared_ptr<Function> import_onnx_model(std::istream& stream,
                                                     const std::string& model_path)
         {
-            ONNX_NAMESPACE::ModelProto model_proto{parse_from_istream(stream)};
+            auto& cache = detail::ImportCache::get();
+            // streams in a bad state are left for the parser to report
+            if (!cache.is_enabled() || !stream.good())
+            {
+                ONNX_NAMESPACE::ModelProto model_proto{parse_from_istream(stream)};
+
+                return detail::import_onnx_model(model_proto, model_path);
+            }
 
-            return detail::import_onnx_model(model_proto, model_path);
+            // read once, the same buffer is hashed and parsed
+            std::string model{std::istreambuf_iterator<char>{stream},
+                              std::istreambuf_iterator<char>{}};
+            const auto key = detail::get_cache_key(model, model_path);
+            if (auto function = cache.find(key))
+            {
+                return function;
+            }
+
+            // taken before the import, so a function converted with operators which are
+            // (un)registered meanwhile doesn't get into the cache
+            const auto generation = cache.get_generation();
+            ONNX_NAMESPACE::ModelProto model_proto{parse_from_string(model)};
+            // the parsed message holds its own copy of the data
+            std::string{}.swap(model);
+            auto function = detail::import_onnx_model(model_proto, model_path);
+            cache.insert(key, function, generation);
+            return function;
         }
 
         std::shared_ptr<Function> import_onnx_model(const std::string& file_path)
@@ -83,6 +251,13 @@ namespace ngraph
             return detail::import_onnx_model(model_editor.model(), model_editor.model_path());
         }
 
+        void set_import_cache_enabled(bool enabled)
+        {
+            detail::ImportCache::get().set_enabled(enabled);
+        }
+
+        void clear_import_cache() { detail::ImportCache::get().clear(); }
+
         std::set<std::string> get_supported_operators(std::int64_t version,
                                                       const std::string& domain)
         {
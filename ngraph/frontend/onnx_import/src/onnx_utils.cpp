@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include "onnx_import/onnx.hpp"
 #include "onnx_import/onnx_utils.hpp"
 #include "ops_bridge.hpp"
 
@@ -27,6 +28,8 @@ namespace ngraph
                                Operator fn)
         {
             OperatorsBridge::register_operator(name, version, domain, std::move(fn));
+            // cached functions were imported with the previous set of operators
+            clear_import_cache();
         }
 
         void unregister_operator(const std::string& name,
@@ -34,6 +37,7 @@ namespace ngraph
                                  const std::string& domain)
         {
             OperatorsBridge::unregister_operator(name, version, domain);
+            clear_import_cache();
         }
 
     } // namespace onnx_import
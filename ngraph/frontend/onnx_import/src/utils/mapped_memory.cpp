@@ -0,0 +1,168 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <map>
+#include <mutex>
+
+#include "ngraph/file_util.hpp"
+#include "utils/mapped_memory.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace detail
+        {
+            namespace
+            {
+                struct Registry
+                {
+                    std::mutex mutex;
+                    std::map<std::string, std::weak_ptr<MappedMemory>> mappings;
+                };
+
+                Registry& get_registry()
+                {
+                    // never destroyed, mappings may outlive static objects
+                    static auto registry = new Registry;
+                    return *registry;
+                }
+            }
+
+#ifdef _WIN32
+            std::shared_ptr<MappedMemory> MappedMemory::map(const std::string& path)
+            {
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+                HANDLE file =
+                    CreateFileW(file_util::multi_byte_char_to_wstring(path.c_str()).c_str(),
+#else
+                HANDLE file = CreateFileA(path.c_str(),
+#endif
+                                GENERIC_READ,
+                                FILE_SHARE_READ,
+                                nullptr,
+                                OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL,
+                                nullptr);
+                if (file == INVALID_HANDLE_VALUE)
+                {
+                    return nullptr;
+                }
+                LARGE_INTEGER file_size;
+                if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0)
+                {
+                    CloseHandle(file);
+                    return nullptr;
+                }
+                HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+                // the view keeps both the mapping and the file alive
+                CloseHandle(file);
+                if (mapping == nullptr)
+                {
+                    return nullptr;
+                }
+                void* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+                CloseHandle(mapping);
+                if (data == nullptr)
+                {
+                    return nullptr;
+                }
+                return share(
+                    static_cast<char*>(data), static_cast<std::size_t>(file_size.QuadPart), path);
+            }
+
+            MappedMemory::~MappedMemory() { UnmapViewOfFile(m_data); }
+#else
+            std::shared_ptr<MappedMemory> MappedMemory::map(const std::string& path)
+            {
+                int fd = open(path.c_str(), O_RDONLY);
+                if (fd == -1)
+                {
+                    return nullptr;
+                }
+                struct stat sb = {};
+                if (fstat(fd, &sb) == -1 || sb.st_size == 0)
+                {
+                    close(fd);
+                    return nullptr;
+                }
+                const auto size = static_cast<std::size_t>(sb.st_size);
+                void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+                // the mapping stays valid after the descriptor is closed
+                close(fd);
+                if (data == MAP_FAILED)
+                {
+                    return nullptr;
+                }
+                return share(static_cast<char*>(data), size, path);
+            }
+
+            MappedMemory::~MappedMemory() { munmap(m_data, m_size); }
+#endif
+
+            std::shared_ptr<MappedMemory> MappedMemory::get(const std::string& path)
+            {
+                auto& registry = get_registry();
+                std::lock_guard<std::mutex> lock{registry.mutex};
+                auto& cached = registry.mappings[path];
+                auto mapping = cached.lock();
+                if (!mapping)
+                {
+                    mapping = map(path);
+                    if (!mapping)
+                    {
+                        registry.mappings.erase(path);
+                        return nullptr;
+                    }
+                    cached = mapping;
+                }
+                return mapping;
+            }
+
+            std::shared_ptr<MappedMemory> MappedMemory::share(char* data,
+                                                              std::size_t size,
+                                                              const std::string& path)
+            {
+                return std::shared_ptr<MappedMemory>(
+                    new MappedMemory(data, size), [path](MappedMemory* memory) {
+                        {
+                            // the entry may already refer to a newer mapping of the same file
+                            auto& registry = get_registry();
+                            std::lock_guard<std::mutex> lock{registry.mutex};
+                            auto it = registry.mappings.find(path);
+                            if (it != registry.mappings.end() && it->second.expired())
+                            {
+                                registry.mappings.erase(it);
+                            }
+                        }
+                        delete memory;
+                    });
+            }
+        }
+    }
+}
@@ -0,0 +1,67 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace detail
+        {
+            /// \brief  Content of a file mapped into memory copy-on-write.
+            ///
+            /// \note   Pages are loaded lazily and shared with the OS page cache,
+            ///         writes to the memory never reach the file.
+            class MappedMemory
+            {
+            public:
+                MappedMemory(const MappedMemory&) = delete;
+                MappedMemory& operator=(const MappedMemory&) = delete;
+                ~MappedMemory();
+
+                /// \brief      Maps the whole file or returns the mapping which is already
+                ///             alive, so all tensors stored in the same file share one mapping.
+                ///
+                /// \param[in]  path  Path to the file.
+                ///
+                /// \return     The mapping or nullptr if the file cannot be mapped.
+                static std::shared_ptr<MappedMemory> get(const std::string& path);
+
+                char* data() const { return m_data; }
+                std::size_t size() const { return m_size; }
+
+            private:
+                MappedMemory(char* data, std::size_t size)
+                    : m_data{data}
+                    , m_size{size}
+                {
+                }
+
+                static std::shared_ptr<MappedMemory> map(const std::string& path);
+                static std::shared_ptr<MappedMemory>
+                    share(char* data, std::size_t size, const std::string& path);
+
+                char* m_data = nullptr;
+                std::size_t m_size = 0;
+            };
+        }
+    }
+}
@@ -73,5 +73,28 @@ namespace ngraph
 
             return model_proto;
         }
+
+        ONNX_NAMESPACE::ModelProto parse_from_string(const std::string& model)
+        {
+            ONNX_NAMESPACE::ModelProto model_proto;
+            if (!model_proto.ParseFromString(model))
+            {
+#ifdef NGRAPH_USE_PROTOBUF_LITE
+                throw ngraph_error(
+                    "Error during import of ONNX model provided as input stream "
+                    " with binary protobuf message.");
+#else
+                // Try parsing input as a prototxt message
+                if (!google::protobuf::TextFormat::ParseFromString(model, &model_proto))
+                {
+                    throw ngraph_error(
+                        "Error during import of ONNX model provided as input stream with prototxt "
+                        "protobuf message.");
+                }
+#endif
+            }
+
+            return model_proto;
+        }
     } // namespace onnx_import
 } // namespace ngraph
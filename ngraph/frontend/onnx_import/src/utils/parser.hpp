@@ -40,6 +40,13 @@ namespace ngraph
         ///
         /// \return  The parsed in-memory representation of the ONNX model
         ONNX_NAMESPACE::ModelProto parse_from_istream(std::istream& model_stream);
+
+        /// \brief   Parses an ONNX model from a buffer holding the serialized model
+        ///
+        /// \param   model  The binary or prototxt protobuf message.
+        ///
+        /// \return  The parsed in-memory representation of the ONNX model
+        ONNX_NAMESPACE::ModelProto parse_from_string(const std::string& model);
     } // namespace onnx_import
 
 } // namespace ngraph
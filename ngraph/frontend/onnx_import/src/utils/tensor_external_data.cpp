@@ -14,11 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <fstream>
 #include <sstream>
 
 #include "exceptions.hpp"
-#include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
 #include "utils/tensor_external_data.hpp"
 
@@ -35,53 +33,43 @@ namespace ngraph
                     if (entry.key() == "location")
                         m_data_location = entry.value();
                     if (entry.key() == "offset")
-                        m_offset = std::stoi(entry.value());
+                        m_offset = std::stoull(entry.value());
                     if (entry.key() == "length")
-                        m_data_lenght = std::stoi(entry.value());
+                        m_data_lenght = std::stoull(entry.value());
                     if (entry.key() == "checksum")
                         m_sha1_digest = std::stoi(entry.value());
                 }
             }
 
-            std::string TensorExternalData::load_external_data() const
+            std::shared_ptr<TensorExternalData::Buffer>
+                TensorExternalData::load_external_mmap_data() const
             {
-#if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-                std::wstring path = file_util::multi_byte_char_to_wstring(m_data_location.c_str());
-#else
-                std::string path = m_data_location;
-#endif
-                std::ifstream external_data_stream(path,
-                                                   std::ios::binary | std::ios::in | std::ios::ate);
-                if (external_data_stream.fail())
+                auto mapping = MappedMemory::get(m_data_location);
+                if (!mapping || m_offset > mapping->size())
                     throw error::invalid_external_data{*this};
 
-                std::streamsize read_data_lenght;
-                if (m_data_lenght == 0) // read entire file
-                    read_data_lenght = external_data_stream.tellg();
+                uint64_t read_data_lenght;
+                if (m_data_lenght == 0) // read till the end of file
+                    read_data_lenght = mapping->size() - m_offset;
                 else
                     read_data_lenght = m_data_lenght;
-
-                const auto page_size = 4096;
-                if (m_offset != 0 && m_offset % page_size != 0)
-                {
-                    NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                                   "support, current value is "
-                                << m_offset;
-                }
-                // default value of m_offset is 0
-                external_data_stream.seekg(m_offset, std::ios::beg);
+                if (read_data_lenght > mapping->size() - m_offset)
+                    throw error::invalid_external_data{*this};
 
                 if (m_sha1_digest != 0)
                 {
                     NGRAPH_WARN << "SHA1 checksum is not supported";
                 }
 
-                std::string read_data;
-                read_data.resize(read_data_lenght);
-                external_data_stream.read(&read_data[0], read_data_lenght);
-                external_data_stream.close();
+                return std::make_shared<Buffer>(mapping->data() + m_offset,
+                                                static_cast<size_t>(read_data_lenght),
+                                                mapping);
+            }
 
-                return read_data;
+            std::string TensorExternalData::load_external_data() const
+            {
+                const auto buffer = load_external_mmap_data();
+                return std::string(buffer->get_ptr<char>(), buffer->size());
             }
 
             std::string TensorExternalData::to_string() const
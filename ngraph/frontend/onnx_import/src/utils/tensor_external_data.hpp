@@ -18,6 +18,9 @@
 
 #include <onnx/onnx_pb.h>
 
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "utils/mapped_memory.hpp"
+
 namespace ngraph
 {
     namespace onnx_import
@@ -28,11 +31,22 @@ namespace ngraph
             class TensorExternalData
             {
             public:
+                using Buffer = ngraph::runtime::SharedBuffer<std::shared_ptr<MappedMemory>>;
+
                 TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor);
 
+                /// \brief      Map external data from tensor passed to constructor
+                ///
+                /// \note       The file is mapped once and shared by all tensors stored in it,
+                ///             the returned buffer points into the mapping without a copy.
+                ///             If reading data from external files fails,
+                ///             the invalid_external_data exception is thrown.
+                ///
+                /// \return     Buffer holding the external data and keeping the mapping alive
+                std::shared_ptr<Buffer> load_external_mmap_data() const;
+
                 /// \brief      Load external data from tensor passed to constructor
                 ///
-                /// \note       If read data from external file fails,
                 /// \note       If reading data from external files fails,
                 ///             the invalid_external_data exception is thrown.
                 ///
@@ -46,8 +60,8 @@ namespace ngraph
 
             private:
                 std::string m_data_location{};
-                int m_offset = 0;
-                int m_data_lenght = 0;
+                uint64_t m_offset = 0;
+                uint64_t m_data_lenght = 0;
                 int m_sha1_digest = 0;
             };
         }
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <numeric>
+
 #include "gtest/gtest.h"
 
 #include "ngraph/ngraph.hpp"
@@ -3168,3 +3170,55 @@ TEST(constant_folding, constant_loop)
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+TEST(constant_folding, independent_branches)
+{
+    const size_t branches = 32;
+    Shape shape_in{2, 3, 4};
+    vector<uint8_t> values_in(shape_size(shape_in));
+    std::iota(values_in.begin(), values_in.end(), 0);
+
+    NodeVector results;
+    for (size_t i = 0; i < branches; ++i)
+    {
+        auto constant = op::Constant::create(element::u8, shape_in, values_in);
+        auto convert = make_shared<op::Convert>(constant, element::f32);
+        auto scale = op::Constant::create(element::f32, Shape{}, {static_cast<float>(i)});
+        auto multiply = make_shared<op::v1::Multiply>(convert, scale);
+        auto perm = op::Constant::create(element::i64, Shape{3}, {2, 0, 1});
+        auto transpose = make_shared<op::Transpose>(multiply, perm);
+        transpose->set_friendly_name("branch" + to_string(i));
+        results.push_back(transpose);
+    }
+    auto f = make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    auto constant_folding = pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::Convert>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Multiply>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::Transpose>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::Constant>(f), branches);
+
+    for (size_t i = 0; i < branches; ++i)
+    {
+        auto new_const =
+            as_type_ptr<op::Constant>(f->get_results()[i]->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(new_const);
+        ASSERT_EQ(new_const->get_friendly_name(), "branch" + to_string(i));
+        ASSERT_EQ(new_const->get_shape(), (Shape{4, 2, 3}));
+
+        vector<float> expected;
+        for (size_t w = 0; w < 4; ++w)
+            for (size_t n = 0; n < 2; ++n)
+                for (size_t c = 0; c < 3; ++c)
+                    expected.push_back(values_in[n * 12 + c * 4 + w] * static_cast<float>(i));
+        range_test_check(new_const->cast_vector<float>(), expected);
+    }
+
+    const auto& statistics = constant_folding->get_statistics();
+    ASSERT_EQ(statistics.count(op::Transpose::type_info.name), 1);
+    EXPECT_EQ(statistics.at(op::Transpose::type_info.name).folded, branches);
+    EXPECT_EQ(statistics.at(op::Convert::type_info.name).folded, branches);
+}
@@ -0,0 +1,154 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <fstream>
+
+#include "gtest/gtest.h"
+#include "ngraph/file_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "onnx_import/onnx.hpp"
+#include "onnx_import/onnx_utils.hpp"
+#include "util/test_control.hpp"
+
+using namespace ngraph;
+
+static std::string s_manifest = "${MANIFEST}";
+
+namespace
+{
+    std::shared_ptr<Function> import_from_stream(const std::string& path)
+    {
+        std::ifstream stream{path, std::ios::in | std::ios::binary};
+        return onnx_import::import_onnx_model(stream, path);
+    }
+
+    class ImportCacheGuard
+    {
+    public:
+        ImportCacheGuard()
+        {
+            onnx_import::clear_import_cache();
+            onnx_import::set_import_cache_enabled(true);
+        }
+        ~ImportCacheGuard()
+        {
+            onnx_import::set_import_cache_enabled(false);
+            onnx_import::clear_import_cache();
+        }
+    };
+}
+
+NGRAPH_TEST(onnx_import_cache, cached_model_is_cloned)
+{
+    ImportCacheGuard guard;
+    const auto path = file_util::path_join(SERIALIZED_ZOO, "onnx/tensor_names.prototxt");
+
+    const auto first = import_from_stream(path);
+    const auto second = import_from_stream(path);
+
+    ASSERT_NE(first, second);
+    ASSERT_EQ(first->get_ordered_ops().size(), second->get_ordered_ops().size());
+    ASSERT_NE(first->get_result(), second->get_result());
+    ASSERT_EQ(first->get_friendly_name(), second->get_friendly_name());
+    ASSERT_EQ(second->get_parameters()[0]->get_friendly_name(), "input");
+    ASSERT_EQ(second->get_result()->get_friendly_name(), "final_output");
+    ASSERT_EQ(second->get_result()->get_input_tensor(0).get_names(),
+              std::unordered_set<std::string>{"final_output"});
+}
+
+NGRAPH_TEST(onnx_import_cache, cached_model_is_not_affected_by_changes)
+{
+    ImportCacheGuard guard;
+    const auto path = file_util::path_join(SERIALIZED_ZOO, "onnx/tensor_names.prototxt");
+
+    const auto first = import_from_stream(path);
+    first->get_parameters()[0]->set_friendly_name("changed");
+    const auto second = import_from_stream(path);
+
+    ASSERT_EQ(second->get_parameters()[0]->get_friendly_name(), "input");
+}
+
+NGRAPH_TEST(onnx_import_cache, different_models_are_not_mixed)
+{
+    ImportCacheGuard guard;
+
+    const auto names =
+        import_from_stream(file_util::path_join(SERIALIZED_ZOO, "onnx/tensor_names.prototxt"));
+    const auto top_k =
+        import_from_stream(file_util::path_join(SERIALIZED_ZOO, "onnx/top_k.prototxt"));
+
+    ASSERT_EQ(names->get_results().size(), 1u);
+    ASSERT_EQ(top_k->get_results().size(), 2u);
+}
+
+NGRAPH_TEST(onnx_import_cache, cached_model_shares_constants)
+{
+    ImportCacheGuard guard;
+    const auto path = file_util::path_join(SERIALIZED_ZOO, "onnx/add_abc_initializers.prototxt");
+    const auto get_constant = [](const std::shared_ptr<Function>& function) {
+        for (const auto& node : function->get_ops())
+        {
+            if (const auto constant = as_type_ptr<op::Constant>(node))
+            {
+                return constant;
+            }
+        }
+        return std::shared_ptr<op::Constant>{};
+    };
+
+    const auto first = get_constant(import_from_stream(path));
+    const auto second = get_constant(import_from_stream(path));
+    const auto third = get_constant(import_from_stream(path));
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, third);
+    ASSERT_EQ(first->get_data_ptr(), second->get_data_ptr());
+    ASSERT_EQ(second->get_data_ptr(), third->get_data_ptr());
+    ASSERT_EQ(third->cast_vector<float>(), (std::vector<float>{1.f, 2.f, 3.f, 4.f}));
+}
+
+NGRAPH_TEST(onnx_import_cache, registered_operator_is_used_by_next_import)
+{
+    ImportCacheGuard guard;
+    const auto path = file_util::path_join(SERIALIZED_ZOO, "onnx/custom_operator.prototxt");
+    const auto count_ops = [](const std::shared_ptr<Function>& function,
+                              const NodeTypeInfo& type_info) {
+        const auto ops = function->get_ops();
+        return std::count_if(ops.begin(), ops.end(), [&](const std::shared_ptr<Node>& node) {
+            return node->get_type_info() == type_info;
+        });
+    };
+
+    onnx_import::register_operator(
+        "AddQ", 1, "com.intel.ai", [](const onnx_import::Node& node) -> OutputVector {
+            OutputVector ng_inputs{node.get_ng_inputs()};
+            return {std::make_shared<op::v1::Add>(ng_inputs.at(0), ng_inputs.at(1))};
+        });
+    // the model has another Add besides the custom operator
+    const auto added = import_from_stream(path);
+    ASSERT_EQ(count_ops(added, op::v1::Add::type_info), 2);
+
+    onnx_import::register_operator(
+        "AddQ", 1, "com.intel.ai", [](const onnx_import::Node& node) -> OutputVector {
+            OutputVector ng_inputs{node.get_ng_inputs()};
+            return {std::make_shared<op::v1::Multiply>(ng_inputs.at(0), ng_inputs.at(1))};
+        });
+    const auto multiplied = import_from_stream(path);
+    onnx_import::unregister_operator("AddQ", 1, "com.intel.ai");
+
+    ASSERT_EQ(count_ops(multiplied, op::v1::Add::type_info), 1);
+    ASSERT_EQ(count_ops(multiplied, op::v1::Multiply::type_info), 1);
+}
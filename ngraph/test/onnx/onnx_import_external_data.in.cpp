@@ -14,6 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstdio>
+#include <fstream>
+#include <map>
+
 #include "default_opset.hpp"
 #include "gtest/gtest.h"
 #include "ngraph/file_util.hpp"
@@ -155,3 +159,103 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_sanitize_path)
 
     test_case.run();
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_offset_till_end_of_file)
+{
+    auto function = onnx_import::import_onnx_model(file_util::path_join(
+        SERIALIZED_ZOO, "onnx/external_data/external_data_offset_till_end_of_file.prototxt"));
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    // first input: {3, 2, 1}, second: {1, 2, 3} read from the offset till the end of file
+    test_case.add_input<int32_t>({2, 3, 1});
+
+    test_case.add_expected_output<int32_t>({3, 3, 3});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_share_file_mapping)
+{
+    auto function = onnx_import::import_onnx_model(file_util::path_join(
+        SERIALIZED_ZOO,
+        "onnx/external_data/external_data_two_tensors_data_in_the_same_file.prototxt"));
+
+    std::map<std::string, std::shared_ptr<default_opset::Constant>> constants;
+    for (const auto& op : function->get_ops())
+    {
+        if (auto constant = as_type_ptr<default_opset::Constant>(op))
+        {
+            constants[constant->get_friendly_name()] = constant;
+        }
+    }
+    ASSERT_EQ(constants.count("data_a"), 1u);
+    ASSERT_EQ(constants.count("data_b"), 1u);
+    // both tensors refer to the same mapping of the file instead of their own copies
+    EXPECT_EQ(constants["data_b"]->get_data_ptr<char>() - constants["data_a"]->get_data_ptr<char>(),
+              4096);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_offset_above_2gb_is_not_truncated)
+{
+    try
+    {
+        auto function = onnx_import::import_onnx_model(file_util::path_join(
+            SERIALIZED_ZOO, "onnx/external_data/external_data_offset_above_2gb.prototxt"));
+        FAIL() << "Missing external data file not detected";
+    }
+    catch (const ngraph_error& error)
+    {
+        EXPECT_PRED_FORMAT2(testing::IsSubstring,
+                            std::string("external_data_offset_above_2gb.data, "
+                                        "offset: 3221225472, data_lenght: 12, sha1_digest: 0)"),
+                            error.what());
+    }
+    catch (...)
+    {
+        FAIL() << "Importing onnx model failed for unexpected reason";
+    }
+}
+
+#if !defined(_WIN32)
+// the data file is sparse, so it takes a few bytes on disk in spite of its size
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_offset_above_2gb)
+{
+    if (sizeof(std::size_t) < sizeof(uint64_t))
+    {
+        return;
+    }
+    const std::string data_path = "external_data_offset_above_2gb.data";
+    {
+        std::ofstream data_file{data_path, std::ios::out | std::ios::binary | std::ios::trunc};
+        ASSERT_TRUE(data_file.is_open());
+        const int32_t data[] = {1, 2, 3};
+        data_file.seekp(3221225472LL);
+        data_file.write(reinterpret_cast<const char*>(data), sizeof(data));
+        ASSERT_TRUE(data_file.good());
+    }
+
+    // the model is read from the stream, so the external data is looked up in the working directory
+    const auto model_path = file_util::path_join(
+        SERIALIZED_ZOO, "onnx/external_data/external_data_offset_above_2gb.prototxt");
+    std::ifstream stream{model_path, std::ios::in | std::ios::binary};
+    ASSERT_TRUE(stream.is_open());
+    std::shared_ptr<Function> function;
+    try
+    {
+        function =
+            onnx_import::import_onnx_model(stream, "external_data_offset_above_2gb.prototxt");
+    }
+    catch (...)
+    {
+        std::remove(data_path.c_str());
+        throw;
+    }
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    test_case.add_input<int32_t>({2, 3, 1});
+    test_case.add_expected_output<int32_t>({2, 3, 3});
+    test_case.run();
+
+    function.reset();
+    std::remove(data_path.c_str());
+}
+#endif
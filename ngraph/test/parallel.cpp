@@ -0,0 +1,51 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <atomic>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/parallel.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(parallel, parallel_for_without_backend_calls_every_index)
+{
+    set_parallel_for_backend({});
+    vector<int> calls(100, 0);
+    parallel_for(calls.size(), [&](size_t i) { calls[i]++; });
+    EXPECT_EQ(calls, vector<int>(100, 1));
+}
+
+TEST(parallel, parallel_for_uses_backend)
+{
+    atomic<size_t> backend_calls{0};
+    set_parallel_for_backend([&](size_t count, const function<void(size_t)>& func) {
+        backend_calls++;
+        for (size_t i = count; i > 0; --i)
+        {
+            func(i - 1);
+        }
+    });
+    vector<int> calls(100, 0);
+    parallel_for(calls.size(), [&](size_t i) { calls[i]++; });
+    set_parallel_for_backend({});
+
+    EXPECT_EQ(backend_calls.load(), 1u);
+    EXPECT_EQ(calls, vector<int>(100, 1));
+}
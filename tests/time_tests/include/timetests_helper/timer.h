@@ -29,4 +29,7 @@ public:
 
 #define SCOPED_TIMER(timer_name) TimeTest::Timer timer_name(#timer_name);
 
+/// Reports a value derived by a pipeline from its measurements, e.g. a normalized duration.
+void reportValue(const std::string &name, float value);
+
 } // namespace TimeTest
\ No newline at end of file
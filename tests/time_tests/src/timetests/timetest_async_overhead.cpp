@@ -0,0 +1,93 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <functional>
+#include <inference_engine.hpp>
+#include <iostream>
+
+#include "common.h"
+#include "timetests_helper/timer.h"
+#include "timetests_helper/utils.h"
+using namespace InferenceEngine;
+
+
+/**
+ * @brief Function that contain executable pipeline which will be called from
+ * main(). The function should not throw any exceptions and responsible for
+ * handling it by itself.
+ *
+ * The pipeline runs a warmed up request many times through StartAsync/Wait and
+ * through Infer. The difference of per-request times is the overhead of the
+ * asynchronous pipeline, which dominates for sub-millisecond models.
+ */
+int runPipeline(const std::string &model, const std::string &device) {
+  auto pipeline = [](const std::string &model, const std::string &device) {
+    constexpr size_t warmupIterations = 100;
+    constexpr size_t iterations = 10000;
+    Core ie;
+    ExecutableNetwork exeNetwork;
+    size_t batchSize = 1;
+
+    if (TimeTest::fileExt(model) == "blob") {
+      exeNetwork = ie.ImportNetwork(model, device);
+    } else {
+      CNNNetwork cnnNetwork = ie.ReadNetwork(model);
+      batchSize = cnnNetwork.getBatchSize() != 0 ? cnnNetwork.getBatchSize() : 1;
+      exeNetwork = ie.LoadNetwork(cnnNetwork, device);
+    }
+    InferRequest inferRequest = exeNetwork.CreateInferRequest();
+    const InferenceEngine::ConstInputsDataMap inputsInfo(exeNetwork.GetInputsInfo());
+    fillBlobs(inferRequest, inputsInfo, batchSize);
+
+    for (size_t i = 0; i < warmupIterations; i++) {
+      inferRequest.StartAsync();
+      inferRequest.Wait(IInferRequest::WaitMode::RESULT_READY);
+    }
+
+    auto measure = [&](const std::function<void()> &run) {
+      auto start = std::chrono::high_resolution_clock::now();
+      for (size_t i = 0; i < iterations; i++)
+        run();
+      return static_cast<float>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    std::chrono::high_resolution_clock::now() - start)
+                                    .count()) / iterations / 1000;
+    };
+
+    float asyncTime = 0;
+    {
+      SCOPED_TIMER(start_async_wait);
+      asyncTime = measure([&] {
+        inferRequest.StartAsync();
+        inferRequest.Wait(IInferRequest::WaitMode::RESULT_READY);
+      });
+    }
+    float syncTime = 0;
+    {
+      SCOPED_TIMER(infer);
+      syncTime = measure([&] { inferRequest.Infer(); });
+    }
+
+    TimeTest::reportValue("start_async_wait_per_request", asyncTime);
+    TimeTest::reportValue("infer_per_request", syncTime);
+    TimeTest::reportValue("async_overhead_per_request", asyncTime - syncTime);
+  };
+
+  try {
+    pipeline(model, device);
+  } catch (const InferenceEngine::details::InferenceEngineException &iex) {
+    std::cerr
+        << "Inference Engine pipeline failed with Inference Engine exception:\n"
+        << iex.what();
+    return 1;
+  } catch (const std::exception &ex) {
+    std::cerr << "Inference Engine pipeline failed with exception:\n"
+              << ex.what();
+    return 2;
+  } catch (...) {
+    std::cerr << "Inference Engine pipeline failed\n";
+    return 3;
+  }
+  return 0;
+}
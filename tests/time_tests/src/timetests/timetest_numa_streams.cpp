@@ -0,0 +1,131 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <condition_variable>
+#include <inference_engine.hpp>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "common.h"
+#include "timetests_helper/timer.h"
+#include "timetests_helper/utils.h"
+using namespace InferenceEngine;
+
+
+/**
+ * @brief Function that contain executable pipeline which will be called from
+ * main(). The function should not throw any exceptions and responsible for
+ * handling it by itself.
+ *
+ * The pipeline runs the optimal number of requests on throughput streams bound
+ * to NUMA nodes and on unbound streams. The NUMA placement of the CPU plugin
+ * is enabled, so on a multi-socket host the bound streams keep their graphs,
+ * requests and blobs on the node they run on, and the ratio of the throughputs
+ * shows the cost of remote memory accesses.
+ */
+int runPipeline(const std::string &model, const std::string &device) {
+  auto pipeline = [](const std::string &model, const std::string &device) {
+    constexpr size_t warmupIterations = 10;
+    constexpr size_t iterations = 1000;
+    Core ie;
+    CNNNetwork cnnNetwork = ie.ReadNetwork(model);
+    const size_t batchSize =
+        cnnNetwork.getBatchSize() != 0 ? cnnNetwork.getBatchSize() : 1;
+
+    auto measure = [&](const std::string &bindThread) {
+      std::map<std::string, std::string> config = {
+          {CONFIG_KEY(CPU_THROUGHPUT_STREAMS), CONFIG_VALUE(CPU_THROUGHPUT_AUTO)},
+          {CONFIG_KEY(CPU_BIND_THREAD), bindThread},
+          {CONFIG_KEY(CPU_NUMA_PLACEMENT), CONFIG_VALUE(YES)}};
+      ExecutableNetwork exeNetwork = ie.LoadNetwork(cnnNetwork, device, config);
+      const auto numRequests =
+          exeNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS))
+              .as<unsigned int>();
+      const InferenceEngine::ConstInputsDataMap inputsInfo(
+          exeNetwork.GetInputsInfo());
+      std::vector<InferRequest> inferRequests;
+      for (unsigned int i = 0; i < numRequests; i++) {
+        inferRequests.push_back(exeNetwork.CreateInferRequest());
+        fillBlobs(inferRequests.back(), inputsInfo, batchSize);
+      }
+
+      // every request restarts itself from its callback until the iterations are done
+      std::mutex mutex;
+      std::condition_variable condVar;
+      size_t totalIterations = 0;
+      size_t started = 0;
+      size_t finished = 0;
+      for (auto &&inferRequest : inferRequests) {
+        InferRequest *request = &inferRequest;
+        request->SetCompletionCallback([&, request] {
+          std::lock_guard<std::mutex> lock{mutex};
+          if (started < totalIterations) {
+            started++;
+            request->StartAsync();
+          }
+          if (++finished == totalIterations)
+            condVar.notify_one();
+        });
+      }
+      auto run = [&](size_t iterationsToRun) {
+        std::unique_lock<std::mutex> lock{mutex};
+        totalIterations = iterationsToRun;
+        started = 0;
+        finished = 0;
+        for (auto &&inferRequest : inferRequests) {
+          if (started == totalIterations)
+            break;
+          started++;
+          inferRequest.StartAsync();
+        }
+        condVar.wait(lock, [&] { return finished == totalIterations; });
+      };
+
+      run(warmupIterations * numRequests);
+      auto start = std::chrono::high_resolution_clock::now();
+      run(iterations);
+      const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                                std::chrono::high_resolution_clock::now() - start)
+                                .count();
+      for (auto &&inferRequest : inferRequests)
+        inferRequest.Wait(IInferRequest::WaitMode::RESULT_READY);
+      return static_cast<float>(iterations * batchSize) * 1000000 / duration;
+    };
+
+    float numaFps = 0;
+    {
+      SCOPED_TIMER(numa_bound_streams);
+      numaFps = measure(CONFIG_VALUE(NUMA));
+    }
+    float unboundFps = 0;
+    {
+      SCOPED_TIMER(unbound_streams);
+      unboundFps = measure(CONFIG_VALUE(NO));
+    }
+
+    TimeTest::reportValue("numa_bound_streams_fps", numaFps);
+    TimeTest::reportValue("unbound_streams_fps", unboundFps);
+    TimeTest::reportValue("numa_binding_speedup", numaFps / unboundFps);
+  };
+
+  try {
+    pipeline(model, device);
+  } catch (const InferenceEngine::details::InferenceEngineException &iex) {
+    std::cerr
+        << "Inference Engine pipeline failed with Inference Engine exception:\n"
+        << iex.what();
+    return 1;
+  } catch (const std::exception &ex) {
+    std::cerr << "Inference Engine pipeline failed with exception:\n"
+              << ex.what();
+    return 2;
+  } catch (...) {
+    std::cerr << "Inference Engine pipeline failed\n";
+    return 3;
+  }
+  return 0;
+}
@@ -0,0 +1,67 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <inference_engine.hpp>
+#include <iostream>
+
+#include "timetests_helper/timer.h"
+using namespace InferenceEngine;
+
+
+/**
+ * @brief Function that contain executable pipeline which will be called from
+ * main(). The function should not throw any exceptions and responsible for
+ * handling it by itself.
+ *
+ * The pipeline only reads the network, so the device isn't used. Besides the
+ * total time it reports the time per 1000 layers to compare IRs of different size.
+ */
+int runPipeline(const std::string &model, const std::string &device) {
+  auto pipeline = [](const std::string &model) {
+    Core ie;
+    CNNNetwork cnnNetwork;
+    size_t layersCount = 0;
+
+    {
+      SCOPED_TIMER(read_network_warmup);
+      // load the reader plugin so it doesn't count towards reading
+      ie.ReadNetwork(model);
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    {
+      SCOPED_TIMER(read_network);
+      cnnNetwork = ie.ReadNetwork(model);
+    }
+    float duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                         std::chrono::high_resolution_clock::now() - start)
+                         .count();
+
+    if (auto function = cnnNetwork.getFunction())
+      layersCount = function->get_ops().size();
+    else
+      layersCount = cnnNetwork.layerCount();
+    if (layersCount != 0)
+      TimeTest::reportValue("read_network_per_1k_layers",
+                            duration * 1000 / layersCount);
+  };
+
+  try {
+    pipeline(model);
+  } catch (const InferenceEngine::details::InferenceEngineException &iex) {
+    std::cerr
+        << "Inference Engine pipeline failed with Inference Engine exception:\n"
+        << iex.what();
+    return 1;
+  } catch (const std::exception &ex) {
+    std::cerr << "Inference Engine pipeline failed with exception:\n"
+              << ex.what();
+    return 2;
+  } catch (...) {
+    std::cerr << "Inference Engine pipeline failed\n";
+    return 3;
+  }
+  return 0;
+}
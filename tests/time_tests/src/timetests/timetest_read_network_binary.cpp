@@ -0,0 +1,82 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <cstdio>
+#include <inference_engine.hpp>
+#include <iostream>
+#include <transformations/serialize_binary.hpp>
+
+#include "timetests_helper/timer.h"
+using namespace InferenceEngine;
+
+
+/**
+ * @brief Function that contain executable pipeline which will be called from
+ * main(). The function should not throw any exceptions and responsible for
+ * handling it by itself.
+ *
+ * The pipeline reads the IR XML model, stores it as the binary IR and reads it
+ * back, so both formats of the same model are compared. The device isn't used.
+ */
+int runPipeline(const std::string &model, const std::string &device) {
+  auto pipeline = [](const std::string &model) {
+    Core ie;
+    const std::string binaryModel = "timetest_read_network_binary.irb";
+
+    auto readNetwork = [&](const std::string &path) {
+      auto start = std::chrono::high_resolution_clock::now();
+      auto cnnNetwork = ie.ReadNetwork(path);
+      float duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                           std::chrono::high_resolution_clock::now() - start)
+                           .count();
+      return std::make_pair(cnnNetwork, duration);
+    };
+
+    // load the reader plugins so they don't count towards reading
+    auto xml = readNetwork(model);
+    ngraph::pass::SerializeBinary(binaryModel)
+        .run_on_function(xml.first.getFunction());
+    readNetwork(binaryModel);
+
+    {
+      SCOPED_TIMER(read_network_xml);
+      xml = readNetwork(model);
+    }
+    decltype(xml) binary;
+    {
+      SCOPED_TIMER(read_network_irb);
+      binary = readNetwork(binaryModel);
+    }
+    std::remove(binaryModel.c_str());
+
+    const size_t layersCount = xml.first.getFunction()->get_ops().size();
+    if (layersCount != 0) {
+      TimeTest::reportValue("read_network_xml_per_1k_layers",
+                            xml.second * 1000 / layersCount);
+      TimeTest::reportValue("read_network_irb_per_1k_layers",
+                            binary.second * 1000 / layersCount);
+    }
+    if (binary.second != 0)
+      TimeTest::reportValue("read_network_xml_to_irb_ratio",
+                            xml.second / binary.second);
+  };
+
+  try {
+    pipeline(model);
+  } catch (const InferenceEngine::details::InferenceEngineException &iex) {
+    std::cerr
+        << "Inference Engine pipeline failed with Inference Engine exception:\n"
+        << iex.what();
+    return 1;
+  } catch (const std::exception &ex) {
+    std::cerr << "Inference Engine pipeline failed with exception:\n"
+              << ex.what();
+    return 2;
+  } catch (...) {
+    std::cerr << "Inference Engine pipeline failed\n";
+    return 3;
+  }
+  return 0;
+}
@@ -26,4 +26,8 @@ Timer::~Timer() {
   StatisticsWriter::Instance().write({name, duration});
 }
 
-} // namespace TimeTest
\ No newline at end of file
+void reportValue(const std::string &name, float value) {
+  StatisticsWriter::Instance().write({name, value});
+}
+
+} // namespace TimeTest